@@ -96,7 +96,11 @@ namespace Breeze
                 break;
 
                 case DecorationButtonType::Menu:
-                QObject::connect(d->client().data(), &KDecoration2::DecoratedClient::iconChanged, b, [b]() { b->update(); });
+                QObject::connect(d->client().data(), &KDecoration2::DecoratedClient::iconChanged, b, [b]()
+                {
+                    b->m_menuIconPixmap = QPixmap();
+                    b->update();
+                });
                 break;
 
                 default: break;
@@ -131,16 +135,7 @@ namespace Breeze
 
             const QRectF iconRect( geometry().topLeft(), m_iconSize );
             if (auto deco =  qobject_cast<Decoration*>(decoration())) {
-                const QPalette activePalette = KIconLoader::global()->customPalette();
-                QPalette palette = decoration()->client().data()->palette();
-                palette.setColor(QPalette::Foreground, deco->fontColor());
-                KIconLoader::global()->setCustomPalette(palette);
-                decoration()->client().data()->icon().paint(painter, iconRect.toRect());
-                if (activePalette == QPalette()) {
-                    KIconLoader::global()->resetPalette();
-                }    else {
-                    KIconLoader::global()->setCustomPalette(palette);
-                }
+                painter->drawPixmap(iconRect.toRect().topLeft(), menuIconPixmap(deco, painter->device()->devicePixelRatioF()));
             } else {
                 decoration()->client().data()->icon().paint(painter, iconRect.toRect());
             }
@@ -155,6 +150,44 @@ namespace Breeze
 
     }
 
+    //__________________________________________________________________
+    QPixmap Button::menuIconPixmap( Decoration* deco, qreal devicePixelRatio )
+    {
+        const QIcon icon( deco->client().data()->icon() );
+        const QColor color( deco->fontColor() );
+        const QSize pixmapSize( m_iconSize*devicePixelRatio );
+        if( !m_menuIconPixmap.isNull() &&
+            m_menuIconKey == icon.cacheKey() &&
+            m_menuIconColor == color &&
+            m_menuIconPixmap.size() == pixmapSize &&
+            m_menuIconPixmap.devicePixelRatio() == devicePixelRatio )
+        { return m_menuIconPixmap; }
+
+        m_menuIconKey = icon.cacheKey();
+        m_menuIconColor = color;
+        m_menuIconPixmap = QPixmap( pixmapSize );
+        m_menuIconPixmap.setDevicePixelRatio( devicePixelRatio );
+        m_menuIconPixmap.fill( Qt::transparent );
+
+        // render icon using the decoration font color
+        const QPalette activePalette = KIconLoader::global()->customPalette();
+        QPalette palette = deco->client().data()->palette();
+        palette.setColor(QPalette::Foreground, color);
+        KIconLoader::global()->setCustomPalette(palette);
+
+        QPainter painter( &m_menuIconPixmap );
+        icon.paint( &painter, QRect( QPoint( 0, 0 ), m_iconSize ) );
+        painter.end();
+
+        if (activePalette == QPalette()) {
+            KIconLoader::global()->resetPalette();
+        } else {
+            KIconLoader::global()->setCustomPalette(activePalette);
+        }
+
+        return m_menuIconPixmap;
+    }
+
     //__________________________________________________________________
     void Button::drawIcon( QPainter *painter ) const
     {
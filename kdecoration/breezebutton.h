@@ -12,6 +12,7 @@
 
 #include <QHash>
 #include <QImage>
+#include <QPixmap>
 
 class QVariantAnimation;
 
@@ -98,6 +99,9 @@ namespace Breeze
         //* draw button icon
         void drawIcon( QPainter *) const;
 
+        //* application icon, rendered for menu button. Result is cached
+        QPixmap menuIconPixmap( Decoration*, qreal devicePixelRatio );
+
         //*@name colors
         //@{
         QColor foregroundColor() const;
@@ -117,6 +121,13 @@ namespace Breeze
 
         //* active state change opacity
         qreal m_opacity = 0;
+
+        //*@name menu icon cache
+        //@{
+        QPixmap m_menuIconPixmap;
+        qint64 m_menuIconKey = 0;
+        QColor m_menuIconColor;
+        //@}
     };
 
 } // namespace
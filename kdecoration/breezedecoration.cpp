@@ -20,15 +20,15 @@
 #include <KDecoration2/DecorationButtonGroup>
 #include <KDecoration2/DecorationShadow>
 
-#include <KConfigGroup>
 #include <KColorUtils>
-#include <KSharedConfig>
 #include <KPluginFactory>
 
+#include <QCoreApplication>
 #include <QPainter>
 #include <QTextStream>
+#include <QThreadPool>
 #include <QTimer>
-#include <QDBusConnection>
+#include <QtConcurrentRun>
 
 #if BREEZE_HAVE_X11
 #include <QX11Info>
@@ -141,11 +141,19 @@ namespace Breeze
     static QSharedPointer<KDecoration2::DecorationShadow> g_sShadow;
     static QSharedPointer<KDecoration2::DecorationShadow> g_sShadowInactive;
 
+    //* pending shadow renders, shared by all decorations. Default constructed futures are canceled
+    static QFuture<QSharedPointer<KDecoration2::DecorationShadow>> g_shadowFuture;
+    static QFuture<QSharedPointer<KDecoration2::DecorationShadow>> g_shadowInactiveFuture;
+
+    //* private pool, so that renders can be waited for before the plugin is unloaded
+    Q_GLOBAL_STATIC(QThreadPool, g_shadowThreadPool)
+
     //________________________________________________________________
     Decoration::Decoration(QObject *parent, const QVariantList &args)
         : KDecoration2::Decoration(parent, args)
         , m_animation( new QVariantAnimation( this ) )
         , m_shadowAnimation( new QVariantAnimation( this ) )
+        , m_shadowWatcher( new QFutureWatcher<ShadowPointer>( this ) )
     {
         g_sDecoCount++;
     }
@@ -157,6 +165,9 @@ namespace Breeze
         if (g_sDecoCount == 0) {
             // last deco destroyed, clean up shadow
             g_sShadow.clear();
+            g_shadowFuture = QFuture<ShadowPointer>();
+            g_shadowInactiveFuture = QFuture<ShadowPointer>();
+            g_shadowThreadPool->waitForDone();
         }
 
         deleteSizeGrip();
@@ -242,12 +253,10 @@ namespace Breeze
             updateShadow();
         });
 
-        // use DBus connection to update on breeze configuration change
-        auto dbus = QDBusConnection::sessionBus();
-        dbus.connect( QString(),
-            QStringLiteral( "/KGlobalSettings" ),
-            QStringLiteral( "org.kde.KGlobalSettings" ),
-            QStringLiteral( "notifyChange" ), this, SLOT(reconfigure()) );
+        connect(m_shadowWatcher, &QFutureWatcherBase::finished, this, &Decoration::applyShadow);
+
+        // configuration is reloaded once by the settings provider, for all decorations
+        connect(SettingsProvider::self(), &SettingsProvider::reconfigured, this, &Decoration::reconfigure);
 
         reconfigure();
         updateTitleBar();
@@ -264,7 +273,6 @@ namespace Breeze
         connect(s.data(), &KDecoration2::DecorationSettings::decorationButtonsRightChanged, this, &Decoration::updateButtonsGeometryDelayed);
 
         // full reconfiguration
-        connect(s.data(), &KDecoration2::DecorationSettings::reconfigured, this, &Decoration::reconfigure);
         connect(s.data(), &KDecoration2::DecorationSettings::reconfigured, SettingsProvider::self(), &SettingsProvider::reconfigure, Qt::UniqueConnection );
         connect(s.data(), &KDecoration2::DecorationSettings::reconfigured, this, &Decoration::updateButtonsGeometryDelayed);
 
@@ -281,11 +289,22 @@ namespace Breeze
         );
 
         connect(c, &KDecoration2::DecoratedClient::activeChanged, this, &Decoration::updateAnimationState);
-        connect(c, &KDecoration2::DecoratedClient::widthChanged, this, &Decoration::updateTitleBar);
         connect(c, &KDecoration2::DecoratedClient::maximizedChanged, this, &Decoration::updateTitleBar);
-        connect(c, &KDecoration2::DecoratedClient::maximizedChanged, this, &Decoration::setOpaque);
 
-        connect(c, &KDecoration2::DecoratedClient::widthChanged, this, &Decoration::updateButtonsGeometry);
+        // opacity depends on colors, corner rounding and compositing
+        connect(c, &KDecoration2::DecoratedClient::maximizedChanged, this, &Decoration::updateOpaque);
+        connect(c, &KDecoration2::DecoratedClient::activeChanged, this, &Decoration::updateOpaque);
+        connect(c, &KDecoration2::DecoratedClient::paletteChanged, this, &Decoration::updateOpaque);
+        connect(c, &KDecoration2::DecoratedClient::adjacentScreenEdgesChanged, this, &Decoration::updateOpaque);
+        connect(c, &KDecoration2::DecoratedClient::maximizedHorizontallyChanged, this, &Decoration::updateOpaque);
+        connect(c, &KDecoration2::DecoratedClient::maximizedVerticallyChanged, this, &Decoration::updateOpaque);
+        connect(c, &KDecoration2::DecoratedClient::shadedChanged, this, &Decoration::updateOpaque);
+        connect(s.data(), &KDecoration2::DecorationSettings::alphaChannelSupportedChanged, this, &Decoration::updateOpaque);
+
+        // width changes come in bursts during interactive resize.
+        // They only move the title bar and right buttons, and are handled once per width
+        connect(c, &KDecoration2::DecoratedClient::widthChanged, this, &Decoration::updateTitleBarGeometry);
+
         connect(c, &KDecoration2::DecoratedClient::maximizedChanged, this, &Decoration::updateButtonsGeometry);
         connect(c, &KDecoration2::DecoratedClient::adjacentScreenEdgesChanged, this, &Decoration::updateButtonsGeometry);
         connect(c, &KDecoration2::DecoratedClient::shadedChanged, this, &Decoration::updateButtonsGeometry);
@@ -307,6 +326,21 @@ namespace Breeze
         setTitleBar(QRect(x, y, width, height));
     }
 
+    //________________________________________________________________
+    void Decoration::updateTitleBarGeometry()
+    {
+        // geometry is updated synchronously, so that the next frame is painted with it.
+        // Repeated signals for the same width are skipped
+        const int width = client().data()->width();
+        if( width == m_titleBarWidth ) return;
+        m_titleBarWidth = width;
+
+        // only the width changed: button sizes and left buttons are unaffected
+        updateTitleBar();
+        updateRightButtonsPosition();
+        update();
+    }
+
     //________________________________________________________________
     void Decoration::updateAnimationState()
     {
@@ -390,17 +424,13 @@ namespace Breeze
         m_internalSettings = SettingsProvider::self()->internalSettings( this );
 
         // animation
-
-        KSharedConfig::Ptr config = KSharedConfig::openConfig();
-        const KConfigGroup cg(config, QStringLiteral("KDE"));
-
         m_animation->setDuration(0);
         // Syncing anis between client and decoration is troublesome, so we're not using
         // any animations right now.
-        // m_animation->setDuration( cg.readEntry("AnimationDurationFactor", 1.0f) * 100.0f );
+        // m_animation->setDuration( SettingsProvider::self()->animationsDuration() );
 
         // But the shadow is fine to animate like this!
-        m_shadowAnimation->setDuration( cg.readEntry("AnimationDurationFactor", 1.0f) * 100.0f );
+        m_shadowAnimation->setDuration( SettingsProvider::self()->animationsDuration() );
 
         // borders
         recalculateBorders();
@@ -460,6 +490,29 @@ namespace Breeze
         }
 
         setResizeOnlyBorders(QMargins(extSides, 0, extSides, extBottom));
+
+        // borders and corner rounding changed
+        updateOpaque();
+    }
+
+    //________________________________________________________________
+    void Decoration::updateOpaque()
+    {
+        auto c = client().data();
+        auto s = settings();
+
+        // rounded corners require blending
+        if( s->isAlphaChannelSupported() && hasRoundedCorners() )
+        {
+            setOpaque( false );
+            return;
+        }
+
+        // translucent color schemes require blending
+        const ColorGroup group( c->isActive() ? ColorGroup::Active : ColorGroup::Inactive );
+        setOpaque(
+            c->color( group, ColorRole::TitleBar ).alpha() == 255 &&
+            c->color( group, ColorRole::Frame ).alpha() == 255 );
     }
 
     //________________________________________________________________
@@ -479,6 +532,9 @@ namespace Breeze
     {
         const auto s = settings();
 
+        // full layout, next width change must be handled
+        m_titleBarWidth = -1;
+
         // adjust button position
         const int bHeight = captionHeight() + (isTopEdge() ? s->smallSpacing()*Metrics::TitleBar_TopMargin:0);
         const int bWidth = buttonHeight();
@@ -522,7 +578,6 @@ namespace Breeze
             m_rightButtons->setSpacing(s->smallSpacing()*Metrics::TitleBar_ButtonSpacing);
 
             // padding
-            const int vPadding = isTopEdge() ? 0 : s->smallSpacing()*Metrics::TitleBar_TopMargin;
             const int hPadding = s->smallSpacing()*Metrics::TitleBar_SideMargin;
             if( isRightEdge() )
             {
@@ -531,9 +586,9 @@ namespace Breeze
                 button->setGeometry( QRectF( QPoint( 0, 0 ), QSizeF( bWidth + hPadding, bHeight ) ) );
                 button->setFlag( Button::FlagLastInList );
 
-                m_rightButtons->setPos(QPointF(size().width() - m_rightButtons->geometry().width(), vPadding));
+            }
 
-            } else m_rightButtons->setPos(QPointF(size().width() - m_rightButtons->geometry().width() - hPadding - borderRight(), vPadding));
+            updateRightButtonsPosition();
 
         }
 
@@ -541,29 +596,62 @@ namespace Breeze
 
     }
 
+    //________________________________________________________________
+    void Decoration::updateRightButtonsPosition()
+    {
+        if( m_rightButtons->buttons().isEmpty() ) return;
+
+        const auto s = settings();
+        const int vPadding = isTopEdge() ? 0 : s->smallSpacing()*Metrics::TitleBar_TopMargin;
+        const int hPadding = s->smallSpacing()*Metrics::TitleBar_SideMargin;
+        if( isRightEdge() ) m_rightButtons->setPos(QPointF(size().width() - m_rightButtons->geometry().width(), vPadding));
+        else m_rightButtons->setPos(QPointF(size().width() - m_rightButtons->geometry().width() - hPadding - borderRight(), vPadding));
+    }
+
     //________________________________________________________________
     void Decoration::paint(QPainter *painter, const QRect &repaintRegion)
     {
-        // TODO: optimize based on repaintRegion
         auto c = client().data();
         auto s = settings();
 
         // paint background
-        if( !c->isShaded() )
+        // only the visible borders are filled, the contents area is covered by the window
+        const QRegion border( c->isShaded() ? QRegion() : borderRegion() & repaintRegion );
+        if( !border.isEmpty() )
         {
-            painter->fillRect(rect(), Qt::transparent);
-            painter->save();
-            painter->setRenderHint(QPainter::Antialiasing);
-            painter->setPen(Qt::NoPen);
-            painter->setBrush( c->color( c->isActive() ? ColorGroup::Active : ColorGroup::Inactive, ColorRole::Frame ) );
+            const QColor frameColor( c->color( c->isActive() ? ColorGroup::Active : ColorGroup::Inactive, ColorRole::Frame ) );
 
-            // clip away the top part
-            if( !hideTitleBar() ) painter->setClipRect(0, borderTop(), size().width(), size().height() - borderTop(), Qt::IntersectClip);
+            // rounded corners are the only parts that need antialiasing
+            QRegion corners;
+            if( s->isAlphaChannelSupported() )
+            {
+                foreach( const QRect& corner, cornerRects() )
+                { corners += corner; }
+                corners &= border;
+            }
 
-            if( s->isAlphaChannelSupported() ) painter->drawRoundedRect(rect(), Metrics::Frame_FrameRadius, Metrics::Frame_FrameRadius);
-            else painter->drawRect( rect() );
+            for( const QRect& rect : border - corners )
+            { painter->fillRect( rect, frameColor ); }
 
-            painter->restore();
+            const int radius = Metrics::Frame_FrameRadius;
+            foreach( const QRect& corner, cornerRects() )
+            {
+                const QRegion clip( corners & corner );
+                if( clip.isEmpty() ) continue;
+
+                // rounded rect of twice the radius, anchored at the outer corner of the frame
+                QRect roundedRect( corner.topLeft(), QSize( 2*radius, 2*radius ) );
+                if( corner.left() > 0 ) roundedRect.moveRight( corner.right() );
+                if( corner.top() > 0 ) roundedRect.moveBottom( corner.bottom() );
+
+                painter->save();
+                painter->setRenderHint(QPainter::Antialiasing);
+                painter->setPen(Qt::NoPen);
+                painter->setBrush( frameColor );
+                painter->setClipRegion( clip, Qt::IntersectClip );
+                painter->drawRoundedRect( roundedRect, radius, radius );
+                painter->restore();
+            }
         }
 
         if( !hideTitleBar() ) paintTitleBar(painter, repaintRegion);
@@ -583,6 +671,54 @@ namespace Breeze
 
     }
 
+    //________________________________________________________________
+    QRegion Decoration::borderRegion() const
+    {
+        const QRect contentsRect( rect().adjusted( borderLeft(), borderTop(), -borderRight(), -borderBottom() ) );
+        QRegion region( QRegion( rect() ) - contentsRect );
+
+        // title bar is painted separately
+        if( !hideTitleBar() ) region -= QRect( 0, 0, size().width(), borderTop() );
+        return region;
+    }
+
+    //________________________________________________________________
+    QVector<QRect> Decoration::cornerRects() const
+    {
+        const QRect rect( this->rect() );
+        const QSize cornerSize( Metrics::Frame_FrameRadius, Metrics::Frame_FrameRadius );
+
+        QVector<QRect> corners;
+        if( hideTitleBar() )
+        {
+            corners.append( QRect( rect.topLeft(), cornerSize ) );
+            corners.append( QRect( QPoint( rect.right() - cornerSize.width() + 1, rect.top() ), cornerSize ) );
+        }
+
+        corners.append( QRect( QPoint( rect.left(), rect.bottom() - cornerSize.height() + 1 ), cornerSize ) );
+        corners.append( QRect( QPoint( rect.right() - cornerSize.width() + 1, rect.bottom() - cornerSize.height() + 1 ), cornerSize ) );
+        return corners;
+    }
+
+    //________________________________________________________________
+    bool Decoration::hasRoundedCorners() const
+    {
+        if( isMaximized() ) return false;
+
+        // shaded windows are painted as a single rounded rect
+        auto c = client().data();
+        if( c->isShaded() ) return true;
+
+        // title bar top corners
+        if( !hideTitleBar() && !( isTopEdge() || ( isLeftEdge() && isRightEdge() ) ) ) return true;
+
+        // frame corners, only rounded where they overlap the painted borders
+        QRegion corners;
+        foreach( const QRect& corner, cornerRects() )
+        { corners += corner; }
+        return !( corners & borderRegion() ).isEmpty();
+    }
+
     //________________________________________________________________
     void Decoration::paintTitleBar(QPainter *painter, const QRect &repaintRegion)
     {
@@ -650,14 +786,30 @@ namespace Breeze
         painter->setFont(s->font());
         painter->setPen( fontColor() );
         const auto cR = captionRect();
-        const QString caption = painter->fontMetrics().elidedText(c->caption(), Qt::ElideMiddle, cR.first.width());
-        painter->drawText(cR.first, cR.second | Qt::TextSingleLine, caption);
+        painter->drawText(cR.first, cR.second | Qt::TextSingleLine, elidedCaption( painter->fontMetrics(), cR.first.width() ) );
 
         // draw all buttons
         m_leftButtons->paint(painter, repaintRegion);
         m_rightButtons->paint(painter, repaintRegion);
     }
 
+    //________________________________________________________________
+    QString Decoration::elidedCaption( const QFontMetrics& metrics, int width ) const
+    {
+        const auto c = client().data();
+        const QString caption( c->caption() );
+        const QFont font( settings()->font() );
+        if( width != m_captionWidth || caption != m_caption || font != m_captionFont )
+        {
+            m_caption = caption;
+            m_captionFont = font;
+            m_captionWidth = width;
+            m_elidedCaption = metrics.elidedText( caption, Qt::ElideMiddle, width );
+        }
+
+        return m_elidedCaption;
+    }
+
     //________________________________________________________________
     int Decoration::buttonHeight() const
     {
@@ -735,37 +887,136 @@ namespace Breeze
     //________________________________________________________________
     void Decoration::updateShadow()
     {
+        const int shadowSize = m_internalSettings->shadowSize();
+        const int shadowStrength = m_internalSettings->shadowStrength();
+        const QColor shadowColor = m_internalSettings->shadowColor();
+
+        // any result still pending is now outdated
+        ++m_shadowGeneration;
+        m_pendingStrengthScale = -1;
+
+        // no shadow, nothing to render
+        if ( lookupShadowParams(shadowSize).isNone() )
+        {
+            m_shadowWatcher->setFuture(QFuture<ShadowPointer>());
+            setShadow(ShadowPointer());
+            return;
+        }
+
         // Animated case, no cached shadow object
         if ( (m_shadowAnimation->state() == QAbstractAnimation::Running) && (m_shadowOpacity != 0.0) && (m_shadowOpacity != 1.0) )
         {
-            setShadow(createShadowObject(m_internalSettings, 0.5 + m_shadowOpacity * 0.5));
+            const float strengthScale = 0.5 + m_shadowOpacity * 0.5;
+
+            // one render at a time, only the newest step is rendered once the current one is done
+            if ( m_shadowWatcher->isRunning() ) m_pendingStrengthScale = strengthScale;
+            else renderAnimatedShadow(strengthScale);
             return;
         }
 
-        if (g_shadowSizeEnum != m_internalSettings->shadowSize()
-                || g_shadowStrength != m_internalSettings->shadowStrength()
-                || g_shadowColor != m_internalSettings->shadowColor())
+        if (g_shadowSizeEnum != shadowSize
+                || g_shadowStrength != shadowStrength
+                || g_shadowColor != shadowColor)
         {
             g_sShadow.clear();
             g_sShadowInactive.clear();
-            g_shadowSizeEnum = m_internalSettings->shadowSize();
-            g_shadowStrength = m_internalSettings->shadowStrength();
-            g_shadowColor = m_internalSettings->shadowColor();
+            g_shadowFuture = QFuture<ShadowPointer>();
+            g_shadowInactiveFuture = QFuture<ShadowPointer>();
+            g_shadowSizeEnum = shadowSize;
+            g_shadowStrength = shadowStrength;
+            g_shadowColor = shadowColor;
         }
 
         auto c = client().toStrongRef();
-        auto& shadow = (c->isActive()) ? g_sShadow : g_sShadowInactive;
-        if ( !shadow )
+        const bool active = c->isActive();
+        const auto& shadow = active ? g_sShadow : g_sShadowInactive;
+        if ( shadow )
+        {
+            // drop pending renders, if any
+            m_shadowWatcher->setFuture(QFuture<ShadowPointer>());
+            setShadow(shadow);
+            return;
+        }
+
+        // use the other cached shadow as a placeholder, if there is no shadow yet
+        const auto& placeholder = active ? g_sShadowInactive : g_sShadow;
+        if ( !this->shadow() && placeholder )
         {
-            shadow = createShadowObject(m_internalSettings, c->isActive() ? 1.0 : 0.5);
+            setShadow(placeholder);
         }
+
+        // render, unless already pending for another decoration
+        auto& future = active ? g_shadowFuture : g_shadowInactiveFuture;
+        if ( future.isCanceled() )
+        {
+            future = QtConcurrent::run(g_shadowThreadPool(), &Decoration::createShadowObject,
+                shadowSize, shadowStrength, shadowColor, active ? 1.0f : 0.5f);
+        }
+        watchShadow(future);
+    }
+
+    //________________________________________________________________
+    void Decoration::watchShadow(const QFuture<ShadowPointer>& future)
+    {
+        m_watchedGeneration = m_shadowGeneration;
+        if ( m_shadowWatcher->future() != future )
+        {
+            m_shadowWatcher->setFuture(future);
+        }
+    }
+
+    //________________________________________________________________
+    void Decoration::renderAnimatedShadow(float strengthScale)
+    {
+        m_pendingStrengthScale = -1;
+        watchShadow(QtConcurrent::run(g_shadowThreadPool(), &Decoration::createShadowObject,
+            m_internalSettings->shadowSize(), m_internalSettings->shadowStrength(), m_internalSettings->shadowColor(), strengthScale));
+    }
+
+    //________________________________________________________________
+    void Decoration::applyShadow()
+    {
+        // dropped renders, or notification from a replaced future
+        if ( m_shadowWatcher->isCanceled() || !m_shadowWatcher->isFinished() )
+        {
+            return;
+        }
+
+        const auto future = m_shadowWatcher->future();
+        const auto shadow = future.result();
+
+        // store in cache, unless settings changed meanwhile
+        const bool isCached = ( future == g_shadowFuture || future == g_shadowInactiveFuture );
+        if ( future == g_shadowFuture )
+        {
+            g_sShadow = shadow;
+            g_shadowFuture = QFuture<ShadowPointer>();
+        }
+        else if ( future == g_shadowInactiveFuture )
+        {
+            g_sShadowInactive = shadow;
+            g_shadowInactiveFuture = QFuture<ShadowPointer>();
+        }
+
+        // a newer animation step was requested meanwhile: show animation results as intermediate steps,
+        // then render only the newest one
+        if ( m_pendingStrengthScale >= 0 )
+        {
+            if ( !isCached ) setShadow(shadow);
+            renderAnimatedShadow(m_pendingStrengthScale);
+            return;
+        }
+
+        // drop outdated results
+        if ( m_watchedGeneration != m_shadowGeneration ) return;
+
         setShadow(shadow);
     }
 
     //________________________________________________________________
-    QSharedPointer<KDecoration2::DecorationShadow> Decoration::createShadowObject(const InternalSettingsPtr& internalSettings, const float strengthScale)
+    Decoration::ShadowPointer Decoration::createShadowObject(int shadowSize, int shadowStrength, const QColor& shadowColor, float strengthScale)
     {
-          const CompositeShadowParams params = lookupShadowParams(internalSettings->shadowSize());
+          const CompositeShadowParams params = lookupShadowParams(shadowSize);
           if (params.isNone())
           {
               return nullptr;
@@ -786,11 +1037,11 @@ namespace Breeze
           shadowRenderer.setBoxSize(boxSize);
           shadowRenderer.setDevicePixelRatio(1.0); // TODO: Create HiDPI shadows?
 
-          const qreal strength = internalSettings->shadowStrength() / 255.0 * strengthScale;
+          const qreal strength = shadowStrength / 255.0 * strengthScale;
           shadowRenderer.addShadow(params.shadow1.offset, params.shadow1.radius,
-              withOpacity(internalSettings->shadowColor(), params.shadow1.opacity * strength));
+              withOpacity(shadowColor, params.shadow1.opacity * strength));
           shadowRenderer.addShadow(params.shadow2.offset, params.shadow2.radius,
-              withOpacity(internalSettings->shadowColor(), params.shadow2.opacity * strength));
+              withOpacity(shadowColor, params.shadow2.opacity * strength));
 
           QImage shadowTexture = shadowRenderer.render();
 
@@ -819,7 +1070,7 @@ namespace Breeze
               Metrics::Frame_FrameRadius + 0.5);
 
           // Draw outline.
-          painter.setPen(withOpacity(internalSettings->shadowColor(), 0.2 * strength));
+          painter.setPen(withOpacity(shadowColor, 0.2 * strength));
           painter.setBrush(Qt::NoBrush);
           painter.setCompositionMode(QPainter::CompositionMode_SourceOver);
           painter.drawRoundedRect(
@@ -833,6 +1084,9 @@ namespace Breeze
           ret->setPadding(padding);
           ret->setInnerShadowRect(QRect(outerRect.center(), QSize(1, 1)));
           ret->setShadow(shadowTexture);
+
+          // created in a worker thread, but used in the main thread
+          ret->moveToThread(QCoreApplication::instance()->thread());
           return ret;
     }
 
@@ -15,6 +15,8 @@
 #include <KDecoration2/DecoratedClient>
 #include <KDecoration2/DecorationSettings>
 
+#include <QFontMetrics>
+#include <QFutureWatcher>
 #include <QPalette>
 #include <QVariant>
 #include <QVariantAnimation>
@@ -96,19 +98,42 @@ namespace Breeze
         void recalculateBorders();
         void updateButtonsGeometry();
         void updateButtonsGeometryDelayed();
+        void updateTitleBarGeometry();
         void updateTitleBar();
         void updateAnimationState();
         void updateSizeGripVisibility();
+        void updateOpaque();
 
         private:
 
         //* return the rect in which caption will be drawn
         QPair<QRect,Qt::Alignment> captionRect() const;
 
+        //* return caption elided to fit a given width. Result is cached
+        QString elidedCaption( const QFontMetrics&, int width ) const;
+
+        //* side and bottom borders, and top border when title bar is hidden
+        QRegion borderRegion() const;
+
+        //* squares containing the frame rounded corners
+        QVector<QRect> cornerRects() const;
+
+        //* true if any corner of the decoration is rounded
+        bool hasRoundedCorners() const;
+
         void createButtons();
+        void updateRightButtonsPosition();
         void paintTitleBar(QPainter *painter, const QRect &repaintRegion);
         void updateShadow();
-        static QSharedPointer<KDecoration2::DecorationShadow> createShadowObject(const InternalSettingsPtr& internalSettings, const float strengthScale);
+
+        //* shadow rendered in a worker thread. Current shadow is kept until it is ready
+        using ShadowPointer = QSharedPointer<KDecoration2::DecorationShadow>;
+        void watchShadow(const QFuture<ShadowPointer>& future);
+        void renderAnimatedShadow(float strengthScale);
+        void applyShadow();
+
+        //* thread safe: only depends on its arguments
+        static ShadowPointer createShadowObject(int shadowSize, int shadowStrength, const QColor& shadowColor, float strengthScale);
 
         //*@name border size
         //@{
@@ -141,6 +166,27 @@ namespace Breeze
         qreal m_opacity = 0;
         qreal m_shadowOpacity = 0;
 
+        //* client width for which title bar geometry was last updated
+        int m_titleBarWidth = -1;
+
+        //* pending shadow
+        QFutureWatcher<ShadowPointer> *m_shadowWatcher;
+
+        //* shadow requests, used to drop outdated results
+        int m_shadowGeneration = 0;
+        int m_watchedGeneration = 0;
+
+        //* newest animation step, waiting for the current render. Negative if none
+        float m_pendingStrengthScale = -1;
+
+        //*@name elided caption cache
+        //@{
+        mutable QString m_caption;
+        mutable QFont m_captionFont;
+        mutable int m_captionWidth = -1;
+        mutable QString m_elidedCaption;
+        //@}
+
     };
 
     bool Decoration::hasBorders() const
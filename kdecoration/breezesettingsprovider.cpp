@@ -8,8 +8,10 @@
 
 #include "breezeexceptionlist.h"
 
+#include <KConfigGroup>
 #include <KWindowInfo>
 
+#include <QDBusConnection>
 #include <QTextStream>
 
 namespace Breeze
@@ -20,7 +22,17 @@ namespace Breeze
     //__________________________________________________________________
     SettingsProvider::SettingsProvider():
         m_config( KSharedConfig::openConfig( QStringLiteral("breezerc") ) )
-    { reconfigure(); }
+    {
+        reconfigure();
+
+        // use DBus connection to update on breeze configuration change
+        // a single connection is shared by all decorations
+        auto dbus = QDBusConnection::sessionBus();
+        dbus.connect( QString(),
+            QStringLiteral( "/KGlobalSettings" ),
+            QStringLiteral( "org.kde.KGlobalSettings" ),
+            QStringLiteral( "notifyChange" ), this, SLOT(reconfigure()) );
+    }
 
     //__________________________________________________________________
     SettingsProvider::~SettingsProvider()
@@ -51,6 +63,12 @@ namespace Breeze
         exceptions.readConfig( m_config );
         m_exceptions = exceptions.get();
 
+        // animations
+        const KConfigGroup cg( KSharedConfig::openConfig(), QStringLiteral("KDE") );
+        m_animationsDuration = cg.readEntry( "AnimationDurationFactor", 1.0f ) * 100.0f;
+
+        emit reconfigured();
+
     }
 
     //__________________________________________________________________
@@ -33,6 +33,15 @@ namespace Breeze
         //* internal settings for given decoration
         InternalSettingsPtr internalSettings(Decoration *) const;
 
+        //* animations duration, from KDE global settings
+        int animationsDuration() const
+        { return m_animationsDuration; }
+
+        Q_SIGNALS:
+
+        //* emitted once configuration has been reloaded
+        void reconfigured();
+
         public Q_SLOTS:
 
         //* reconfigure
@@ -52,6 +61,9 @@ namespace Breeze
         //* config object
         KSharedConfigPtr m_config;
 
+        //* animations duration
+        int m_animationsDuration = 100;
+
         //* singleton
         static SettingsProvider *s_self;
 
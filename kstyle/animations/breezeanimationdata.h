@@ -69,6 +69,14 @@ namespace Breeze
         virtual void setDirty() const
         { if( _target ) _target.data()->update(); }
 
+        //* trigger target update, limited to given rect. Whole target is updated if rect is invalid
+        void setDirtyRect( const QRect& rect ) const
+        {
+            if( !_target ) return;
+            else if( rect.isValid() ) _target.data()->update( rect );
+            else _target.data()->update();
+        }
+
         private:
 
         //* guarded target
@@ -25,6 +25,29 @@ namespace Breeze
         setupAnimation( previousIndexAnimation(), "previousOpacity" );
         previousIndexAnimation().data()->setDirection( Animation::Backward );
 
+        // cached section rects are invalidated whenever the header is painted or resized
+        target->installEventFilter( this );
+        if( auto header = qobject_cast<QHeaderView*>( target ) )
+        { header->viewport()->installEventFilter( this ); }
+
+    }
+
+    //______________________________________________
+    bool HeaderViewData::eventFilter( QObject* object, QEvent* event )
+    {
+
+        switch( event->type() )
+        {
+            case QEvent::Paint:
+            case QEvent::Resize:
+            _rectsValid = false;
+            break;
+
+            default: break;
+        }
+
+        return AnimationData::eventFilter( object, event );
+
     }
 
     //______________________________________________
@@ -36,38 +59,33 @@ namespace Breeze
         const QHeaderView* local( qobject_cast<const QHeaderView*>( target().data() ) );
         if( !local ) return false;
 
-        const int index( local->logicalIndexAt( position ) );
-        if( index < 0 ) return false;
-
-        if( hovered )
+        // check current index first, using its cached rect
+        updateRects();
+        if( currentIndex() >= 0 && _current._rect.contains( position ) )
         {
 
+            if( hovered ) return false;
 
-            if( index != currentIndex() )
-            {
-
-                if( currentIndex() >= 0 )
-                {
-                    setPreviousIndex( currentIndex() );
-                    setCurrentIndex( -1 );
-                    previousIndexAnimation().data()->restart();
-                }
-
-                setCurrentIndex( index );
-                currentIndexAnimation().data()->restart();
-
-                return true;
+            setPreviousIndex( currentIndex() );
+            setCurrentIndex( -1 );
+            previousIndexAnimation().data()->restart();
+            return true;
 
-            } else return false;
+        } else if( !hovered ) return false;
 
-        } else if( index == currentIndex() ) {
+        const int index( local->logicalIndexAt( position ) );
+        if( index < 0 || index == currentIndex() ) return false;
 
+        if( currentIndex() >= 0 )
+        {
             setPreviousIndex( currentIndex() );
             setCurrentIndex( -1 );
             previousIndexAnimation().data()->restart();
-            return true;
+        }
 
-        } else return false;
+        setCurrentIndex( index );
+        currentIndexAnimation().data()->restart();
+        return true;
 
     }
 
@@ -77,10 +95,7 @@ namespace Breeze
 
         if( !enabled() )  return Animation::Pointer();
 
-        const QHeaderView* local( qobject_cast<const QHeaderView*>( target().data() ) );
-        if( !local ) return Animation::Pointer();
-
-        int index( local->logicalIndexAt( position ) );
+        const int index( hoveredIndex( position ) );
         if( index < 0 ) return Animation::Pointer();
         else if( index == currentIndex() ) return currentIndexAnimation();
         else if( index == previousIndex() ) return previousIndexAnimation();
@@ -94,10 +109,7 @@ namespace Breeze
 
         if( !enabled() ) return OpacityInvalid;
 
-        const QHeaderView* local( qobject_cast<const QHeaderView*>( target().data() ) );
-        if( !local ) return OpacityInvalid;
-
-        int index( local->logicalIndexAt( position ) );
+        const int index( hoveredIndex( position ) );
         if( index < 0 ) return OpacityInvalid;
         else if( index == currentIndex() ) return currentOpacity();
         else if( index == previousIndex() ) return previousOpacity();
@@ -112,21 +124,47 @@ namespace Breeze
         QHeaderView* header = qobject_cast<QHeaderView*>( target().data() );
         if( !header ) return;
 
-        // get first and last index, sorted
-        const int lastIndex( qMax( previousIndex(), currentIndex() ) );
-        if( lastIndex < 0 ) return;
+        // update current and previous sections, in viewport coordinates
+        updateRects();
+        const QRect rect( _current._rect | _previous._rect );
+        if( rect.isValid() ) header->viewport()->update( rect );
+        else header->viewport()->update();
+
+    }
 
-        int firstIndex( qMin( previousIndex(), currentIndex() ) );
-        if( firstIndex < 0 ) firstIndex = lastIndex;
+    //______________________________________________
+    int HeaderViewData::hoveredIndex( const QPoint& position ) const
+    {
 
-        // find relevant rectangle to be updated, in viewport coordinate
-        QWidget* viewport( header->viewport() );
-        const int left = header->sectionViewportPosition( firstIndex );
-        const int right = header->sectionViewportPosition( lastIndex ) + header->sectionSize( lastIndex );
+        updateRects();
+        if( currentIndex() >= 0 && _current._rect.contains( position ) ) return currentIndex();
+        else if( previousIndex() >= 0 && _previous._rect.contains( position ) ) return previousIndex();
+        else return -1;
 
-        // trigger update
-        if( header->orientation() == Qt::Horizontal ) viewport->update( left, 0, right-left, header->height() );
-        else viewport->update( 0, left, header->width(), right-left );
+    }
+
+    //______________________________________________
+    void HeaderViewData::updateRects() const
+    {
+
+        if( _rectsValid ) return;
+
+        const QHeaderView* local( qobject_cast<const QHeaderView*>( target().data() ) );
+        if( !local ) return;
+
+        // section rect, in viewport coordinates
+        auto sectionRect = [local]( int index )
+        {
+            if( index < 0 || index >= local->count() || local->isSectionHidden( index ) ) return QRect();
+            const int position( local->sectionViewportPosition( index ) );
+            const int size( local->sectionSize( index ) );
+            if( local->orientation() == Qt::Horizontal ) return QRect( position, 0, size, local->height() );
+            else return QRect( 0, position, local->width(), size );
+        };
+
+        _current._rect = sectionRect( currentIndex() );
+        _previous._rect = sectionRect( previousIndex() );
+        _rectsValid = true;
 
     }
 
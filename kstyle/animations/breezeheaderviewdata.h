@@ -28,6 +28,9 @@ namespace Breeze
         //* constructor
         HeaderViewData( QObject* parent, QWidget* target, int duration );
 
+        //* event filter
+        bool eventFilter( QObject*, QEvent* ) override;
+
         //* duration
         void setDuration( int duration ) override
         {
@@ -60,7 +63,10 @@ namespace Breeze
 
         //* current index
         void setCurrentIndex( int index )
-        { _current._index = index; }
+        {
+            _current._index = index;
+            _rectsValid = false;
+        }
 
         //* current index animation
         const Animation::Pointer& currentIndexAnimation() const
@@ -90,7 +96,10 @@ namespace Breeze
 
         //* previous index
         void setPreviousIndex( int index )
-        { _previous._index = index; }
+        {
+            _previous._index = index;
+            _rectsValid = false;
+        }
 
         //* previous index Animation
         const Animation::Pointer& previousIndexAnimation() const
@@ -111,6 +120,12 @@ namespace Breeze
 
         private:
 
+        //* return current or previous index if at given position, -1 otherwise
+        int hoveredIndex( const QPoint& ) const;
+
+        //* update current and previous section rects
+        void updateRects() const;
+
         //* container for needed animation data
         class Data
         {
@@ -125,6 +140,9 @@ namespace Breeze
             Animation::Pointer _animation;
             qreal _opacity;
             int _index;
+
+            //* section rect, cached
+            mutable QRect _rect;
         };
 
         //* current tab animation data (for hover enter animations)
@@ -133,6 +151,9 @@ namespace Breeze
         //* previous tab animations data (for hover leave animations)
         Data _previous;
 
+        //* true when cached rects match current layout
+        mutable bool _rectsValid = false;
+
     };
 
 }
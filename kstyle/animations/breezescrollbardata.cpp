@@ -23,6 +23,13 @@ namespace Breeze
 
         target->installEventFilter( this );
 
+        // hit test data depend on scrollbar range and value
+        if( auto scrollBar = qobject_cast<QScrollBar*>( target ) )
+        {
+            connect( scrollBar, &QAbstractSlider::rangeChanged, this, &ScrollBarData::clearHitTestData );
+            connect( scrollBar, &QAbstractSlider::valueChanged, this, &ScrollBarData::clearHitTestData );
+        }
+
         _addLineData._animation = new Animation( duration, this );
         _subLineData._animation = new Animation( duration, this );
         _grooveData._animation = new Animation( duration, this );
@@ -65,6 +72,14 @@ namespace Breeze
             hoverLeaveEvent( object, event );
             break;
 
+            case QEvent::Resize:
+            case QEvent::StyleChange:
+            case QEvent::LayoutDirectionChange:
+            clearHitTestData();
+            _addLineData._rect = QRect();
+            _subLineData._rect = QRect();
+            break;
+
             default: break;
 
         }
@@ -123,12 +138,17 @@ namespace Breeze
         QScrollBar* scrollBar( qobject_cast<QScrollBar*>( object ) );
         if( !scrollBar || scrollBar->isSliderDown() ) return;
 
-        // retrieve scrollbar option
-        QStyleOptionSlider opt( qt_qscrollbarStyleOption( scrollBar ) );
+        // orientation change does not trigger any event
+        if( !_hitTestValid || _hitTestOption.orientation != scrollBar->orientation() )
+        { updateHitTestData( scrollBar ); }
 
         // cast event
         QHoverEvent *hoverEvent = static_cast<QHoverEvent*>(event);
-        QStyle::SubControl hoverControl = scrollBar->style()->hitTestComplexControl(QStyle::CC_ScrollBar, &opt, hoverEvent->pos(), scrollBar);
+
+        // line buttons are always outside of the groove
+        const QStyle::SubControl hoverControl = _grooveRect.contains( hoverEvent->pos() ) ?
+            QStyle::SC_ScrollBarGroove :
+            scrollBar->style()->hitTestComplexControl(QStyle::CC_ScrollBar, &_hitTestOption, hoverEvent->pos(), scrollBar);
 
         // update hover state
         updateAddLineArrow( hoverControl );
@@ -140,6 +160,14 @@ namespace Breeze
     }
 
 
+    //______________________________________________
+    void ScrollBarData::updateHitTestData( QScrollBar* scrollBar )
+    {
+        _hitTestOption = qt_qscrollbarStyleOption( scrollBar );
+        _grooveRect = scrollBar->style()->subControlRect( QStyle::CC_ScrollBar, &_hitTestOption, QStyle::SC_ScrollBarGroove, scrollBar );
+        _hitTestValid = true;
+    }
+
     //______________________________________________
     void ScrollBarData::hoverLeaveEvent(  QObject*, QEvent* )
     {
@@ -10,6 +10,9 @@
 #include "breezewidgetstatedata.h"
 
 #include <QStyle>
+#include <QStyleOptionSlider>
+
+class QScrollBar;
 
 namespace Breeze
 {
@@ -99,7 +102,7 @@ namespace Breeze
             value = digitize( value );
             if( _addLineData._opacity == value ) return;
             _addLineData._opacity = value;
-            setDirty();
+            setDirtyRect( _addLineData._rect );
         }
 
         //* addLine opacity
@@ -112,7 +115,7 @@ namespace Breeze
             value = digitize( value );
             if( _subLineData._opacity == value ) return;
             _subLineData._opacity = value;
-            setDirty();
+            setDirtyRect( _subLineData._rect );
         }
 
         //* subLine opacity
@@ -152,8 +155,15 @@ namespace Breeze
             { _subLineData._rect = QRect(); }
         }
 
+        //* invalidate cached option and groove rect used for hit test
+        void clearHitTestData()
+        { _hitTestValid = false; }
+
         private:
 
+        //* update cached option and groove rect used for hit test
+        void updateHitTestData( QScrollBar* );
+
         //* hoverMoveEvent
         void hoverMoveEvent( QObject*, QEvent* );
 
@@ -240,6 +250,20 @@ namespace Breeze
         //* mouse position
         QPoint _position;
 
+        //*@name hit test data
+        //@{
+
+        //* true if cached option and groove rect match scrollbar state
+        bool _hitTestValid = false;
+
+        //* scrollbar option
+        QStyleOptionSlider _hitTestOption;
+
+        //* groove rect
+        QRect _grooveRect;
+
+        //@}
+
     };
 
 }
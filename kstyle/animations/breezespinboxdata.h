@@ -37,6 +37,13 @@ namespace Breeze
             else return false;
         }
 
+        //* subcontrol rect, used to limit updates
+        void setSubControlRect( QStyle::SubControl subControl, const QRect& rect )
+        {
+            if( subControl == QStyle::SC_SpinBoxUp ) _upArrowData._rect = rect;
+            else if( subControl == QStyle::SC_SpinBoxDown ) _downArrowData._rect = rect;
+        }
+
         //* animation state
         bool isAnimated( QStyle::SubControl subControl ) const
         {
@@ -73,7 +80,7 @@ namespace Breeze
             value = digitize( value );
             if( _upArrowData._opacity == value ) return;
             _upArrowData._opacity = value;
-            setDirty();
+            setDirtyRect( _upArrowData._rect );
         }
 
         //* animation
@@ -95,7 +102,7 @@ namespace Breeze
             value = digitize( value );
             if( _downArrowData._opacity == value ) return;
             _downArrowData._opacity = value;
-            setDirty();
+            setDirtyRect( _downArrowData._rect );
         }
 
         //* animation
@@ -130,6 +137,9 @@ namespace Breeze
             //* opacity
             qreal _opacity;
 
+            //* arrow rect
+            QRect _rect;
+
         };
 
         //* up arrow data
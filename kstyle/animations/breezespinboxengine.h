@@ -39,6 +39,13 @@ namespace Breeze
             } else return false;
         }
 
+        //* subcontrol rect
+        void setSubControlRect( const QObject* object, QStyle::SubControl subControl, const QRect& rect )
+        {
+            if( DataMap<SpinBoxData>::Value data = _data.find( object ) )
+            { data.data()->setSubControlRect( subControl, rect ); }
+        }
+
         //* true if widget is animated
         bool isAnimated( const QObject* object, QStyle::SubControl subControl )
         {
@@ -27,6 +27,30 @@ namespace Breeze
         setupAnimation( previousIndexAnimation(), "previousOpacity" );
         previousIndexAnimation().data()->setDirection( Animation::Backward );
 
+        // cached tab rects are invalidated whenever the tabbar is painted or resized
+        target->installEventFilter( this );
+
+    }
+
+    //______________________________________________
+    bool TabBarData::eventFilter( QObject* object, QEvent* event )
+    {
+
+        if( object == target().data() )
+        {
+            switch( event->type() )
+            {
+                case QEvent::Paint:
+                case QEvent::Resize:
+                _rectsValid = false;
+                break;
+
+                default: break;
+            }
+        }
+
+        return AnimationData::eventFilter( object, event );
+
     }
 
     //______________________________________________
@@ -35,10 +59,7 @@ namespace Breeze
 
         if( !enabled() ) return Animation::Pointer();
 
-        const QTabBar* local( qobject_cast<const QTabBar*>( target().data() ) );
-        if( !local ) return Animation::Pointer();
-
-        int index( local->tabAt( position ) );
+        const int index( hoveredIndex( position ) );
         if( index < 0 ) return Animation::Pointer();
         else if( index == currentIndex() ) return currentIndexAnimation();
         else if( index == previousIndex() ) return previousIndexAnimation();
@@ -55,37 +76,33 @@ namespace Breeze
         const QTabBar* local( qobject_cast<const QTabBar*>( target().data() ) );
         if( !local ) return false;
 
-        int index( local->tabAt( position ) );
-        if( index < 0 ) return false;
-
-        if( hovered )
+        // check current index first, using its cached rect
+        updateRects();
+        if( currentIndex() >= 0 && _current._rect.contains( position ) )
         {
 
+            if( hovered ) return false;
 
-            if( index != currentIndex() )
-            {
-
-                if( currentIndex() >= 0 )
-                {
-                    setPreviousIndex( currentIndex() );
-                    setCurrentIndex( -1 );
-                    previousIndexAnimation().data()->restart();
-                }
-
-                setCurrentIndex( index );
-                currentIndexAnimation().data()->restart();
-                return true;
+            setPreviousIndex( currentIndex() );
+            setCurrentIndex( -1 );
+            previousIndexAnimation().data()->restart();
+            return true;
 
-            } else return false;
+        } else if( !hovered ) return false;
 
-        } else if( index == currentIndex() ) {
+        const int index( local->tabAt( position ) );
+        if( index < 0 || index == currentIndex() ) return false;
 
+        if( currentIndex() >= 0 )
+        {
             setPreviousIndex( currentIndex() );
             setCurrentIndex( -1 );
             previousIndexAnimation().data()->restart();
-            return true;
+        }
 
-        } else return false;
+        setCurrentIndex( index );
+        currentIndexAnimation().data()->restart();
+        return true;
 
     }
 
@@ -95,10 +112,7 @@ namespace Breeze
 
         if( !enabled() ) return OpacityInvalid;
 
-        const QTabBar* local( qobject_cast<const QTabBar*>( target().data() ) );
-        if( !local ) return OpacityInvalid;
-
-        int index( local->tabAt( position ) );
+        const int index( hoveredIndex( position ) );
         if( index < 0 ) return OpacityInvalid;
         else if( index == currentIndex() ) return currentOpacity();
         else if( index == previousIndex() ) return previousOpacity();
@@ -106,5 +120,40 @@ namespace Breeze
 
     }
 
+    //______________________________________________
+    void TabBarData::setDirty() const
+    {
+
+        // only update current and previous tabs
+        updateRects();
+        setDirtyRect( _current._rect | _previous._rect );
+
+    }
+
+    //______________________________________________
+    int TabBarData::hoveredIndex( const QPoint& position ) const
+    {
+
+        updateRects();
+        if( currentIndex() >= 0 && _current._rect.contains( position ) ) return currentIndex();
+        else if( previousIndex() >= 0 && _previous._rect.contains( position ) ) return previousIndex();
+        else return -1;
+
+    }
+
+    //______________________________________________
+    void TabBarData::updateRects() const
+    {
+
+        if( _rectsValid ) return;
+
+        const QTabBar* local( qobject_cast<const QTabBar*>( target().data() ) );
+        if( !local ) return;
+
+        _current._rect = currentIndex() >= 0 ? local->tabRect( currentIndex() ) : QRect();
+        _previous._rect = previousIndex() >= 0 ? local->tabRect( previousIndex() ) : QRect();
+        _rectsValid = true;
+
+    }
 
 }
@@ -29,6 +29,9 @@ namespace Breeze
         //* constructor
         TabBarData( QObject* parent, QWidget* target, int duration );
 
+        //* event filter
+        bool eventFilter( QObject*, QEvent* ) override;
+
         //* duration
         void setDuration( int duration ) override
         {
@@ -60,7 +63,10 @@ namespace Breeze
 
         //* current index
         void setCurrentIndex( int index )
-        { _current._index = index; }
+        {
+            _current._index = index;
+            _rectsValid = false;
+        }
 
         //* current index animation
         const Animation::Pointer& currentIndexAnimation() const
@@ -89,7 +95,10 @@ namespace Breeze
 
         //* previous index
         void setPreviousIndex( int index )
-        { _previous._index = index; }
+        {
+            _previous._index = index;
+            _rectsValid = false;
+        }
 
         //* previous index Animation
         const Animation::Pointer& previousIndexAnimation() const
@@ -103,8 +112,19 @@ namespace Breeze
         //* return opacity associated to action at given position, if any
         qreal opacity( const QPoint& position ) const;
 
+        protected:
+
+        //* dirty
+        void setDirty() const override;
+
         private:
 
+        //* return current or previous index if at given position, -1 otherwise
+        int hoveredIndex( const QPoint& ) const;
+
+        //* update current and previous tab rects
+        void updateRects() const;
+
         //* container for needed animation data
         class Data
         {
@@ -119,6 +139,9 @@ namespace Breeze
             Animation::Pointer _animation;
             qreal _opacity;
             int _index;
+
+            //* tab rect, cached
+            mutable QRect _rect;
         };
 
         //* current tab animation data (for hover enter animations)
@@ -127,6 +150,9 @@ namespace Breeze
         //* previous tab animations data (for hover leave animations)
         Data _previous;
 
+        //* true when cached rects match current layout
+        mutable bool _rectsValid = false;
+
     };
 
 }
@@ -13,11 +13,14 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "breezeblurhelper.h"
+#include "breezemetrics.h"
 #include "breezestyleconfigdata.h"
 
 #include <KWindowEffects>
 
 #include <QEvent>
+#include <QPainterPath>
+#include <QTimerEvent>
 #include <QVector>
 
 namespace Breeze
@@ -34,8 +37,8 @@ namespace Breeze
         // install event filter
         addEventFilter(widget);
 
-        // schedule shadow area repaint
-        update(widget);
+        // schedule blur region update
+        delayedUpdate(widget);
     }
 
     //___________________________________________________________
@@ -43,6 +46,10 @@ namespace Breeze
     {
         // remove event filter
         widget->removeEventFilter(this);
+
+        // forget pending update and registered region
+        _pendingWidgets.remove(widget);
+        _blurRegions.remove(widget);
     }
 
     //___________________________________________________________
@@ -50,6 +57,16 @@ namespace Breeze
     {
         switch (event->type()) {
             case QEvent::Hide:
+            {
+                /*
+                the native window might be recreated when shown again,
+                so that the blur region must then be passed again to the compositor
+                */
+                _pendingWidgets.remove(static_cast<QWidget*>(object));
+                _blurRegions.remove(object);
+                break;
+            }
+
             case QEvent::Show:
             case QEvent::Resize:
             {
@@ -59,7 +76,7 @@ namespace Breeze
                 if (!widget)
                     break;
 
-                update(widget);
+                delayedUpdate(widget);
                 break;
             }
 
@@ -71,7 +88,52 @@ namespace Breeze
     }
 
     //___________________________________________________________
-    void BlurHelper::update(QWidget* widget) const
+    void BlurHelper::timerEvent(QTimerEvent* event)
+    {
+        if (event->timerId() == _timer.timerId()) {
+            _timer.stop();
+
+            const auto pendingWidgets(_pendingWidgets);
+            _pendingWidgets.clear();
+            for (const auto& widget : pendingWidgets) {
+                if (widget) {
+                    update(widget.data());
+                }
+            }
+
+        } else {
+            QObject::timerEvent(event);
+        }
+    }
+
+    //___________________________________________________________
+    QRegion BlurHelper::blurRegion(QWidget* widget) const
+    {
+        if (!widget->isVisible())
+            return QRegion();
+
+        // use widget mask if any
+        const QRegion mask(widget->mask());
+        if (!mask.isEmpty())
+            return mask;
+
+        // rounded rect matching the menu frame, so that transparent corners are not blurred
+        QPainterPath path;
+        path.addRoundedRect(widget->rect(), Metrics::Frame_FrameRadius, Metrics::Frame_FrameRadius);
+        return QRegion(path.toFillPolygon().toPolygon());
+    }
+
+    //___________________________________________________________
+    void BlurHelper::delayedUpdate(QWidget* widget)
+    {
+        _pendingWidgets.insert(widget, widget);
+        if (!_timer.isActive()) {
+            _timer.start(0, this);
+        }
+    }
+
+    //___________________________________________________________
+    void BlurHelper::update(QWidget* widget)
     {
         /*
         directly from bespin code. Supposedly prevent playing with some 'pseudo-widgets'
@@ -80,7 +142,18 @@ namespace Breeze
         if (!(widget->testAttribute(Qt::WA_WState_Created) || widget->internalWinId()))
             return;
 
-        KWindowEffects::enableBlurBehind(widget->winId(), true);
+        const QRegion region(blurRegion(widget));
+        if (region.isEmpty())
+            return;
+
+        // skip if neither the window nor the region changed since last call
+        const BlurRegion value(widget->winId(), region);
+        const auto iter(_blurRegions.constFind(widget));
+        if (iter != _blurRegions.constEnd() && iter.value() == value)
+            return;
+
+        KWindowEffects::enableBlurBehind(value.first, true, value.second);
+        _blurRegions.insert(widget, value);
 
         // force update
         if (widget->isVisible()) {
@@ -18,8 +18,12 @@
 #include "breeze.h"
 #include "breezehelper.h"
 
+#include <QBasicTimer>
 #include <QHash>
 #include <QObject>
+#include <QPair>
+#include <QRegion>
+#include <QWidget>
 
 namespace Breeze
 {
@@ -50,8 +54,33 @@ namespace Breeze
             object->installEventFilter( this );
         }
 
+        //! timer event
+        /*! used to perform delayed blur region update of pending widgets */
+        void timerEvent( QTimerEvent* ) override;
+
+        //! blur region for given widget
+        QRegion blurRegion( QWidget* ) const;
+
+        //! schedule blur region update for given widget
+        /*! updates are performed once per event loop iteration */
+        void delayedUpdate( QWidget* );
+
         //! update blur regions for given widget
-        void update( QWidget* ) const;
+        void update( QWidget* );
+
+        private:
+
+        //! list of widgets for which blur region must be updated
+        using WidgetPointer = WeakPointer<QWidget>;
+        using WidgetSet = QHash<QWidget*, WidgetPointer>;
+        WidgetSet _pendingWidgets;
+
+        //! last window id and blur region passed to the compositor, per widget
+        using BlurRegion = QPair<WId, QRegion>;
+        QHash<const QObject*, BlurRegion> _blurRegions;
+
+        //! delayed update timer
+        QBasicTimer _timer;
 
     };
 
@@ -109,8 +109,9 @@ namespace Breeze
         widget->installEventFilter(this);
 
         widget->installEventFilter( &_addEventFilter );
-        installShadow( widget, helper, SideTop );
-        installShadow( widget, helper, SideBottom );
+        auto shadow = new FrameShadow( helper );
+        shadow->setParent( widget );
+        shadow->hide();
         widget->removeEventFilter( &_addEventFilter );
 
     }
@@ -135,64 +136,46 @@ namespace Breeze
     }
 
     //____________________________________________________________________________________
-    void FrameShadowFactory::updateShadowsGeometry( const QObject* object, QRect rect ) const
+    FrameShadow* FrameShadowFactory::findShadow( const QObject* object ) const
     {
 
         const QList<QObject *> &children = object->children();
         foreach( QObject *child, children )
         {
             if( FrameShadow* shadow = qobject_cast<FrameShadow *>(child) )
-            { shadow->updateGeometry( rect ); }
+            { return shadow; }
         }
 
+        return nullptr;
+
     }
 
     //____________________________________________________________________________________
-    void FrameShadowFactory::raiseShadows( QObject* object ) const
+    void FrameShadowFactory::updateShadowsGeometry( const QObject* object, QRect rect ) const
     {
-
-        const QList<QObject *> &children = object->children();
-        foreach( QObject *child, children )
-        {
-            if( FrameShadow* shadow = qobject_cast<FrameShadow *>(child) )
-            { shadow->raise(); }
-        }
-
+        if( FrameShadow* shadow = findShadow( object ) )
+        { shadow->updateGeometry( rect ); }
     }
 
     //____________________________________________________________________________________
-    void FrameShadowFactory::update( QObject* object ) const
+    void FrameShadowFactory::raiseShadows( QObject* object ) const
     {
-
-        const QList<QObject* > &children = object->children();
-        foreach( QObject *child, children )
-        {
-            if( FrameShadow* shadow = qobject_cast<FrameShadow *>(child) )
-            { shadow->update();}
-        }
-
+        if( FrameShadow* shadow = findShadow( object ) )
+        { shadow->raise(); }
     }
 
     //____________________________________________________________________________________
-    void FrameShadowFactory::updateState( const QWidget* widget, bool focus, bool hover, qreal opacity, AnimationMode mode ) const
+    void FrameShadowFactory::update( QObject* object ) const
     {
-
-        const QList<QObject *> &children = widget->children();
-        foreach( QObject *child, children )
-        {
-            if( FrameShadow* shadow = qobject_cast<FrameShadow *>(child) )
-            { shadow->updateState( focus, hover, opacity, mode ); }
-        }
-
+        if( FrameShadow* shadow = findShadow( object ) )
+        { shadow->update( shadow->region() ); }
     }
 
     //____________________________________________________________________________________
-    void FrameShadowFactory::installShadow( QWidget* widget, Helper& helper, Side area ) const
+    void FrameShadowFactory::updateState( const QWidget* widget, bool focus, bool hover, qreal opacity, AnimationMode mode ) const
     {
-        FrameShadow *shadow(nullptr);
-        shadow = new FrameShadow( area, helper );
-        shadow->setParent(widget);
-        shadow->hide();
+        if( FrameShadow* shadow = findShadow( widget ) )
+        { shadow->updateState( focus, hover, opacity, mode ); }
     }
 
     //____________________________________________________________________________________
@@ -200,9 +183,8 @@ namespace Breeze
     { _registeredWidgets.remove( object ); }
 
     //____________________________________________________________________________________
-    FrameShadow::FrameShadow( Side area, Helper& helper ):
-        _helper( helper ),
-        _area( area )
+    FrameShadow::FrameShadow( Helper& helper ):
+        _helper( helper )
     {
 
         setAttribute(Qt::WA_OpaquePaintEvent, false);
@@ -237,32 +219,14 @@ namespace Breeze
         // for efficiency, take out the part for which nothing is rendered
         rect.adjust( 1, 1, -1, -1 );
 
-        // adjust geometry
-        const int shadowSize( Metrics::Frame_FrameRadius );
-        switch( _area )
+        // update painted region, made of the top and bottom parts of the frame
+        // the overlay is masked to it, so that the rest of the viewport is not composed through the overlay
+        if( rect.size() != size() || _region.isEmpty() )
         {
-
-            case SideTop:
-            rect.setHeight( shadowSize );
-            break;
-
-            case SideBottom:
-            rect.setTop( rect.bottom() - shadowSize + 1 );
-            break;
-
-            case SideLeft:
-            rect.setWidth(shadowSize);
-            rect.adjust(0, shadowSize, 0, -shadowSize );
-            break;
-
-
-            case SideRight:
-            rect.setLeft(rect.right() - shadowSize + 1 );
-            rect.adjust(0, shadowSize, 0, -shadowSize );
-            break;
-
-            default:
-            return;
+            const int shadowSize( Metrics::Frame_FrameRadius );
+            _region = QRegion( 0, 0, rect.width(), shadowSize );
+            _region += QRegion( 0, rect.height() - shadowSize, rect.width(), shadowSize );
+            setMask( _region );
         }
 
         setGeometry(rect);
@@ -287,27 +251,19 @@ namespace Breeze
         }
 
         if( _opacity != opacity ) { _opacity = opacity; changed |= (_mode != AnimationNone ); }
-        if( changed )
-        {
-
-            if( QWidget* viewport = this->viewport() )
-            {
-
-                // need to disable viewport updates to avoid some redundant painting
-                // besides it fixes one visual glitch (from Qt) in QTableViews
-                viewport->setUpdatesEnabled( false );
-                update() ;
-                viewport->setUpdatesEnabled( true );
-
-            } else update();
 
-        }
+        // only repaint the strips. The overlay is masked, so the viewport is left alone
+        if( changed ) update( _region );
     }
 
     //____________________________________________________________________________________
     void FrameShadow::paintEvent(QPaintEvent *event )
     {
 
+        // only paint the parts that overlap the frame
+        const QRegion region( event->region() & _region );
+        if( region.isEmpty() ) return;
+
         // this fixes shadows in frames that change frameStyle() after polish()
         if( QFrame *frame = qobject_cast<QFrame *>( parentWidget() ) )
         { if (frame->frameStyle() != (QFrame::StyledPanel | QFrame::Sunken)) return; }
@@ -317,7 +273,7 @@ namespace Breeze
 
         // render
         QPainter painter(this);
-        painter.setClipRegion( event->region() );
+        painter.setClipRegion( region );
         painter.setRenderHint( QPainter::Antialiasing );
 
         const QColor outline( _helper.frameOutlineColor( palette(), _mouseOver, _hasFocus, _opacity, _mode ) );
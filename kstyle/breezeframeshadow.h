@@ -15,6 +15,7 @@
 #include <QObject>
 #include <QSet>
 
+#include <QRegion>
 #include <QWidget>
 #include <QPaintEvent>
 #include <KColorScheme>
@@ -22,6 +23,8 @@
 namespace Breeze
 {
 
+    class FrameShadow;
+
     //* shadow manager
     class FrameShadowFactory: public QObject
     {
@@ -68,8 +71,8 @@ namespace Breeze
         //* update shadows
         void update( QObject* ) const;
 
-        //* install shadow on given side
-        void installShadow( QWidget*, Helper&, Side ) const;
+        //* find shadow installed on given widget, if any
+        FrameShadow* findShadow( const QObject* ) const;
 
         protected Q_SLOTS:
 
@@ -87,7 +90,11 @@ namespace Breeze
     };
 
     //* frame shadow
-    /** this allows the shadow to be painted over the widgets viewport */
+    /**
+    this allows the shadow to be painted over the widgets viewport.
+    A single overlay is used per frame. It is masked to the top and bottom parts of the frame,
+    where its rounded corners overlap the viewport
+    */
     class FrameShadow : public QWidget
     {
         Q_OBJECT
@@ -95,7 +102,7 @@ namespace Breeze
         public:
 
         //* constructor
-        FrameShadow( Side, Helper& );
+        explicit FrameShadow( Helper& );
 
         //* update geometry
         virtual void updateGeometry( QRect );
@@ -103,6 +110,10 @@ namespace Breeze
         //* update state
         void updateState( bool focus, bool hover, qreal opacity, AnimationMode );
 
+        //* painted region
+        const QRegion& region() const
+        { return _region; }
+
         protected:
 
         //* painting
@@ -116,8 +127,8 @@ namespace Breeze
         //* helper
         Helper& _helper;
 
-        //* shadow area
-        Side _area;
+        //* painted region, in local coordinates
+        QRegion _region;
 
         //* margins
         /** offsets between update rect and parent widget rect. It is set via updateGeometry */
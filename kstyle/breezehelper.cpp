@@ -41,10 +41,16 @@ namespace Breeze
         QObject ( parent ),
         _config( std::move( config ) ),
         _kwinConfig( KSharedConfig::openConfig("kwinrc") ),
-        _decorationConfig( new InternalSettings() )
+        _decorationConfig( new InternalSettings() ),
+        _coloredIconCache( 256 )
     {
+        // colored icons depend on the icon theme
+        connect( KIconLoader::global(), &KIconLoader::iconChanged, this, &Helper::invalidateColoredIcons );
+        connect( KIconLoader::global(), &KIconLoader::iconLoaderSettingsChanged, this, &Helper::invalidateColoredIcons );
+
         if (qApp) {
             connect(qApp, &QApplication::paletteChanged, this, [=]() {
+                invalidateColoredIcons();
                 if (qApp->property("KDE_COLOR_SCHEME_PATH").isValid()) {
                     const auto path = qApp->property("KDE_COLOR_SCHEME_PATH").toString();
                     KConfig config(path, KConfig::SimpleConfig);
@@ -83,6 +89,7 @@ namespace Breeze
         _kwinConfig->reparseConfiguration();
         _cachedAutoValid = false;
         _decorationConfig->load();
+        invalidateColoredIcons();
 
         KConfig config(qApp->property("KDE_COLOR_SCHEME_PATH").toString(), KConfig::SimpleConfig);
         KConfigGroup appGroup( config.group("WM") );
@@ -1619,8 +1626,25 @@ namespace Breeze
         return pixmap.devicePixelRatio();
     }
 
+    //______________________________________________________________________________________
     QPixmap Helper::coloredIcon(const QIcon& icon,  const QPalette& palette, const QSize &size, QIcon::Mode mode, QIcon::State state)
     {
+        if (icon.isNull()) {
+            return QPixmap();
+        }
+
+        // the pixmap returned by QIcon uses the application device pixel ratio
+        const ColoredIconKey key = {
+            icon.cacheKey(),
+            palette.color(QPalette::WindowText).rgba(),
+            palette.color(QPalette::Window).rgba(),
+            palette.color(QPalette::Highlight).rgba(),
+            palette.color(QPalette::HighlightedText).rgba(),
+            size, mode, state, qApp ? qApp->devicePixelRatio() : 1.0 };
+        if (const QPixmap* cached = _coloredIconCache.object(key)) {
+            return *cached;
+        }
+
         const QPalette activePalette = KIconLoader::global()->customPalette();
         const bool changePalette = activePalette != palette;
         if (changePalette) {
@@ -1634,6 +1658,8 @@ namespace Breeze
                 KIconLoader::global()->setCustomPalette(activePalette);
             }
         }
+
+        _coloredIconCache.insert(key, new QPixmap(pixmap));
         return pixmap;
     }
 
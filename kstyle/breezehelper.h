@@ -17,6 +17,7 @@
 #include <KSharedConfig>
 #include <KConfigWatcher>
 
+#include <QCache>
 #include <QToolBar>
 #include <QPainterPath>
 #include <QIcon>
@@ -293,9 +294,14 @@ namespace Breeze
         //* return a QRectF with the appropriate size for a rectangle with a pen stroke
         QRectF strokedRect( const QRect &rect, const int penWidth = PenWidth::Frame ) const;
         
+        //* return icon pixmap rendered with a given palette. Result is cached
         QPixmap coloredIcon(const QIcon &icon, const QPalette& palette, const QSize &size,
                             QIcon::Mode mode = QIcon::Normal, QIcon::State state = QIcon::Off);
 
+        //* clear colored icon cache
+        void invalidateColoredIcons()
+        { _coloredIconCache.clear(); }
+
         protected:
 
         //* return rounded path in a given rect, with only selected corners rounded, and for a given radius
@@ -332,6 +338,51 @@ namespace Breeze
 
         mutable bool _cachedAutoValid = false;
 
+        //* colored icon cache key
+        /**
+        palette colors used by the icon loader for recoloring are stored, rather than the palette cache key,
+        which differs for every copy of a palette that is detached or modified
+        */
+        struct ColoredIconKey
+        {
+            qint64 icon;
+            QRgb text;
+            QRgb background;
+            QRgb highlight;
+            QRgb highlightedText;
+            QSize size;
+            int mode;
+            int state;
+            qreal devicePixelRatio;
+
+            bool operator == ( const ColoredIconKey& other ) const
+            {
+                return icon == other.icon
+                    && text == other.text
+                    && background == other.background
+                    && highlight == other.highlight
+                    && highlightedText == other.highlightedText
+                    && size == other.size
+                    && mode == other.mode
+                    && state == other.state
+                    && qFuzzyCompare( devicePixelRatio, other.devicePixelRatio );
+            }
+
+        };
+
+        friend uint qHash( const ColoredIconKey& key, uint seed )
+        {
+            return qHash( key.icon, seed )
+                ^ qHash( key.text, seed )
+                ^ qHash( key.background ^ key.highlight ^ key.highlightedText, seed )
+                ^ qHash( ( key.size.width() << 16 ) | key.size.height(), seed )
+                ^ qHash( ( key.mode << 8 ) | key.state, seed )
+                ^ qHash( qRound( key.devicePixelRatio*100 ), seed );
+        }
+
+        //* colored icon cache
+        QCache<ColoredIconKey, QPixmap> _coloredIconCache;
+
         friend class ToolsAreaManager;
 
     };
@@ -20,9 +20,10 @@ namespace Breeze
 {
 
     //____________________________________________________________________
-    MdiWindowShadow::MdiWindowShadow( QWidget* parent, const TileSet &shadowTiles ):
+    MdiWindowShadow::MdiWindowShadow( QWidget* parent, const TileSet &shadowTiles, const QMargins &shadowMargins ):
         QWidget( parent ),
-        _shadowTiles( shadowTiles )
+        _shadowTiles( shadowTiles ),
+        _shadowMargins( shadowMargins )
     {
         setAttribute( Qt::WA_OpaquePaintEvent, false );
         setAttribute( Qt::WA_TransparentForMouseEvents, true );
@@ -30,33 +31,31 @@ namespace Breeze
     }
 
     //____________________________________________________________________
-    void MdiWindowShadow::updateGeometry()
+    void MdiWindowShadow::setShadowTiles( const TileSet &shadowTiles, const QMargins &shadowMargins )
     {
-        if( !_widget ) return;
-
-        // metrics
-        const CompositeShadowParams params = ShadowHelper::lookupShadowParams( StyleConfigData::shadowSize() );
-        if( params.isNone() ) return;
-
-        const QSize boxSize = BoxShadowRenderer::calculateMinimumBoxSize(params.shadow1.radius)
-            .expandedTo(BoxShadowRenderer::calculateMinimumBoxSize(params.shadow2.radius));
+        _shadowTiles = shadowTiles;
+        _shadowMargins = shadowMargins;
 
-        const QSize shadowSize = BoxShadowRenderer::calculateMinimumShadowTextureSize(boxSize, params.shadow1.radius, params.shadow1.offset)
-            .expandedTo(BoxShadowRenderer::calculateMinimumShadowTextureSize(boxSize, params.shadow2.radius, params.shadow2.offset));
-
-        const QRect shadowRect(QPoint(0, 0), shadowSize);
+        // geometry may not change, repaint with the new tiles
+        if( _widget && _widget->isVisible() ) updateGeometry();
+        update();
+    }
 
-        QRect boxRect(QPoint(0, 0), boxSize);
-        boxRect.moveCenter(shadowRect.center());
+    //____________________________________________________________________
+    void MdiWindowShadow::updateGeometry()
+    {
+        if( !_widget ) return;
 
-        const int topSize( boxRect.top() - shadowRect.top() - Metrics::Shadow_Overlap - params.offset.y() );
-        const int bottomSize( shadowRect.bottom() - boxRect.bottom() - Metrics::Shadow_Overlap + params.offset.y() );
-        const int leftSize( boxRect.left() - shadowRect.left() - Metrics::Shadow_Overlap - params.offset.x() );
-        const int rightSize( shadowRect.right() - boxRect.right() - Metrics::Shadow_Overlap + params.offset.x() );
+        // metrics. No shadow when margins are null
+        if( _shadowMargins.isNull() )
+        {
+            hide();
+            return;
+        }
 
         // get tileSet rect
         auto hole = _widget->frameGeometry();
-        _shadowTilesRect = hole.adjusted( -leftSize, -topSize, rightSize, bottomSize );
+        _shadowTilesRect = hole + _shadowMargins;
 
         // get parent MDI area's viewport
         auto parent( parentWidget() );
@@ -74,19 +73,19 @@ namespace Breeze
             hole &= parent->rect();
         }
 
-        // update geometry and mask
-        const QRegion mask = QRegion( geometry ) - hole.adjusted( 2, 2, -2, -2 );
-        if( mask.isEmpty() ) hide();
+        // update geometry. The window rect is excluded at paint time rather than using a mask
+        hole.adjust( 2, 2, -2, -2 );
+        if( geometry.isEmpty() || hole.contains( geometry ) ) hide();
         else {
 
             setGeometry( geometry );
-            setMask( mask.translated( -geometry.topLeft() ) );
             show();
 
         }
 
-        // translate rendering rect
+        // translate rendering rects
         _shadowTilesRect.translate( -geometry.topLeft() );
+        _holeRect = hole.translated( -geometry.topLeft() );
 
     }
 
@@ -102,7 +101,7 @@ namespace Breeze
 
         QPainter painter( this );
         painter.setRenderHints( QPainter::Antialiasing );
-        painter.setClipRegion( event->region() );
+        painter.setClipRegion( _holeRect.isValid() ? event->region() - _holeRect : event->region() );
         _shadowTiles.render( _shadowTilesRect, &painter );
 
     }
@@ -112,6 +111,47 @@ namespace Breeze
         QObject( parent )
     {}
 
+    //____________________________________________________________________________________
+    void MdiWindowShadowFactory::setShadowHelper( ShadowHelper* shadowHelper )
+    {
+        _shadowHelper = shadowHelper;
+
+        // update shadow tiles and margins
+        _shadowTiles = _shadowHelper ? _shadowHelper->shadowTiles() : TileSet();
+        _shadowMargins = shadowMargins();
+
+        // update existing shadows
+        foreach( const QPointer<MdiWindowShadow>& windowShadow, _shadows )
+        { if( windowShadow ) windowShadow->setShadowTiles( _shadowTiles, _shadowMargins ); }
+
+    }
+
+    //____________________________________________________________________________________
+    QMargins MdiWindowShadowFactory::shadowMargins()
+    {
+
+        const CompositeShadowParams params = ShadowHelper::lookupShadowParams( StyleConfigData::shadowSize() );
+        if( params.isNone() ) return QMargins();
+
+        const QSize boxSize = BoxShadowRenderer::calculateMinimumBoxSize(params.shadow1.radius)
+            .expandedTo(BoxShadowRenderer::calculateMinimumBoxSize(params.shadow2.radius));
+
+        const QSize shadowSize = BoxShadowRenderer::calculateMinimumShadowTextureSize(boxSize, params.shadow1.radius, params.shadow1.offset)
+            .expandedTo(BoxShadowRenderer::calculateMinimumShadowTextureSize(boxSize, params.shadow2.radius, params.shadow2.offset));
+
+        const QRect shadowRect(QPoint(0, 0), shadowSize);
+
+        QRect boxRect(QPoint(0, 0), boxSize);
+        boxRect.moveCenter(shadowRect.center());
+
+        return QMargins(
+            boxRect.left() - shadowRect.left() - Metrics::Shadow_Overlap - params.offset.x(),
+            boxRect.top() - shadowRect.top() - Metrics::Shadow_Overlap - params.offset.y(),
+            shadowRect.right() - boxRect.right() - Metrics::Shadow_Overlap + params.offset.x(),
+            shadowRect.bottom() - boxRect.bottom() - Metrics::Shadow_Overlap + params.offset.y() );
+
+    }
+
     //____________________________________________________________________________________
     bool MdiWindowShadowFactory::registerWidget( QWidget* widget )
     {
@@ -194,15 +234,10 @@ namespace Breeze
         // check object,
         if( !object->parent() ) return nullptr;
 
-        // find existing window shadows
-        auto children = object->parent()->children();
-        foreach( QObject *child, children )
-        {
-            if( MdiWindowShadow* shadow = qobject_cast<MdiWindowShadow*>(child) )
-            { if( shadow->widget() == object ) return shadow; }
-        }
-
-        return nullptr;
+        // find existing window shadow, making sure it still shares the object's parent
+        MdiWindowShadow* windowShadow( _shadows.value( object ).data() );
+        if( windowShadow && windowShadow->parent() == object->parent() ) return windowShadow;
+        else return nullptr;
 
     }
 
@@ -219,16 +254,20 @@ namespace Breeze
 
         if ( !_shadowHelper ) return;
 
+        // remove shadow left in a previous parent, if any
+        removeShadow( object );
+
         // create new shadow
-        auto windowShadow( new MdiWindowShadow( widget->parentWidget(), _shadowHelper->shadowTiles() ) );
+        auto windowShadow( new MdiWindowShadow( widget->parentWidget(), _shadowTiles, _shadowMargins ) );
         windowShadow->setWidget( widget );
+        _shadows.insert( object, windowShadow );
 
     }
 
     //____________________________________________________________________________________
     void MdiWindowShadowFactory::removeShadow( QObject* object )
     {
-        if( MdiWindowShadow* windowShadow = findShadow( object ) )
+        if( MdiWindowShadow* windowShadow = _shadows.take( object ).data() )
         {
             windowShadow->hide();
             windowShadow->deleteLater();
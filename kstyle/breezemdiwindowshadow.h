@@ -8,6 +8,8 @@
 #define breezemdiwindowshadow_h
 
 #include <QEvent>
+#include <QHash>
+#include <QMargins>
 #include <QObject>
 #include <QSet>
 
@@ -32,7 +34,10 @@ namespace Breeze
         public:
 
         //* constructor
-        explicit MdiWindowShadow( QWidget*, const TileSet & );
+        explicit MdiWindowShadow( QWidget*, const TileSet &, const QMargins & );
+
+        //* set shadow tiles and margins
+        void setShadowTiles( const TileSet &, const QMargins & );
 
         //* update geometry
         void updateGeometry();
@@ -61,9 +66,15 @@ namespace Breeze
         //* tileset rect, used for painting
         QRect _shadowTilesRect;
 
+        //* window rect, excluded from painting
+        QRect _holeRect;
+
         //* tileset used to draw shadow
         TileSet _shadowTiles;
 
+        //* shadow margins, around the window frame
+        QMargins _shadowMargins;
+
     };
 
     //* shadow manager
@@ -78,8 +89,8 @@ namespace Breeze
         explicit MdiWindowShadowFactory( QObject* );
 
         //* set shadow helper
-        void setShadowHelper( ShadowHelper* shadowHelper )
-        { _shadowHelper = shadowHelper; }
+        /** shadow tiles and margins are updated for existing shadows */
+        void setShadowHelper( ShadowHelper* );
 
         //* register widget
         bool registerWidget( QWidget* );
@@ -99,6 +110,9 @@ namespace Breeze
         //* find shadow matching a given object
         MdiWindowShadow* findShadow( QObject* ) const;
 
+        //* shadow margins matching current configuration
+        static QMargins shadowMargins();
+
         //* install shadows on given widget
         void installShadow( QObject* );
 
@@ -146,6 +160,15 @@ namespace Breeze
         //* set of registered widgets
         QSet<const QObject*> _registeredWidgets;
 
+        //* shadows, per subwindow
+        QHash<const QObject*, QPointer<MdiWindowShadow>> _shadows;
+
+        //* shadow tiles
+        TileSet _shadowTiles;
+
+        //* shadow margins
+        QMargins _shadowMargins;
+
         //* shadow helper used to generate the shadows
         QPointer<ShadowHelper> _shadowHelper;
 
@@ -20,24 +20,54 @@ namespace Breeze
         {
             case StyleConfigData::MN_NEVER:
             qApp->removeEventFilter( this );
+            setTracking( false );
             setEnabled( false );
             break;
 
             default:
             case StyleConfigData::MN_ALWAYS:
             qApp->removeEventFilter( this );
+            setTracking( false );
             setEnabled( true );
             break;
 
             case StyleConfigData::MN_AUTO:
             qApp->removeEventFilter( this );
             qApp->installEventFilter( this );
-            setEnabled( false );
+
+            if( !_tracking )
+            {
+
+                /*
+                no widget is registered yet.
+                Repaint all top level widgets, so that the ones rendering mnemonics get registered
+                */
+                _tracking = true;
+                _enabled = false;
+                updateTopLevelWidgets();
+
+            } else setEnabled( false );
             break;
 
         }
 
-        
+    }
+
+    //____________________________________________________
+    void Mnemonics::registerWidget( QWidget* widget, const QRect& rect )
+    {
+
+        if( !( _tracking && widget ) ) return;
+
+        auto iter( _widgets.find( widget ) );
+        if( iter == _widgets.end() )
+        {
+
+            connect( widget, &QObject::destroyed, this, &Mnemonics::widgetDestroyed, Qt::UniqueConnection );
+            _widgets.insert( widget, rect );
+
+        } else iter.value() |= rect;
+
     }
 
     //____________________________________________________
@@ -76,10 +106,40 @@ namespace Breeze
 
         _enabled = value;
 
-        // update all top level widgets
+        if( _tracking )
+        {
+
+            /*
+            only update the registered rects in visible widgets.
+            The map is cleared, since repainting registers the widgets again
+            and hidden widgets are fully repainted when shown
+            */
+            const auto widgets( _widgets );
+            _widgets.clear();
+            for( auto iter = widgets.constBegin(); iter != widgets.constEnd(); ++iter )
+            { if( iter.key()->isVisible() ) iter.key()->update( iter.value() ); }
+
+        } else updateTopLevelWidgets();
+
+    }
+
+    //____________________________________________________
+    void Mnemonics::updateTopLevelWidgets() const
+    {
         foreach( QWidget* widget, qApp->topLevelWidgets() )
         { widget->update(); }
+    }
 
+    //____________________________________________________
+    void Mnemonics::setTracking( bool value )
+    {
+        if( _tracking == value ) return;
+        _tracking = value;
+        if( !_tracking ) _widgets.clear();
     }
 
+    //____________________________________________________
+    void Mnemonics::widgetDestroyed( QObject* object )
+    { _widgets.remove( static_cast<QWidget*>( object ) ); }
+
 }
@@ -8,8 +8,11 @@
 #define breezemnemonics_h
 
 #include <QEvent>
+#include <QHash>
 #include <QObject>
 #include <QApplication>
+#include <QRect>
+#include <QWidget>
 
 #include "breezestyleconfigdata.h"
 
@@ -42,16 +45,44 @@ namespace Breeze
         int textFlags() const
         { return _enabled ? Qt::TextShowMnemonic : Qt::TextHideMnemonic; }
 
+        //* true if widgets rendering mnemonics must be registered
+        bool isTracking() const
+        { return _tracking; }
+
+        //* register widget rect in which mnemonic text is rendered
+        /**
+        only used in auto mode, so that toggling mnemonics visibility
+        only repaints the relevant rects rather than all top level widgets
+        */
+        void registerWidget( QWidget*, const QRect& );
+
         protected:
 
         //* set enable state
         void setEnabled( bool );
 
+        //* set tracking state
+        void setTracking( bool );
+
+        //* update all top level widgets
+        void updateTopLevelWidgets() const;
+
+        protected Q_SLOTS:
+
+        //* remove widget from map when destroyed
+        void widgetDestroyed( QObject* );
+
         private:
 
         //* enable state
         bool _enabled = true;
 
+        //* true if widgets rendering mnemonics are tracked
+        bool _tracking = false;
+
+        //* widgets rendering mnemonics, and matching rect
+        QHash<QWidget*, QRect> _widgets;
+
     };
 
 }
@@ -97,7 +97,8 @@ namespace Breeze
     {
         _tiles.clear();
         _shadowTiles = TileSet();
-
+        _shadowTexture = QImage();
+        _config = ShadowConfig();
     }
 
     //_______________________________________________________
@@ -145,8 +146,20 @@ namespace Breeze
     void ShadowHelper::loadConfig()
     {
 
+        /*
+        keep shadow tiles and installed native shadows alive
+        if the shadow appearance is unchanged
+        */
+        ShadowConfig config;
+        config.size = StyleConfigData::shadowSize();
+        config.strength = StyleConfigData::shadowStrength();
+        config.color = StyleConfigData::shadowColor();
+        config.devicePixelRatio = qApp->devicePixelRatio();
+        if( config == _config ) return;
+
         // reset
         reset();
+        _config = config;
 
         // update property for registered widgets
         for( QWidget* widget : _widgets)
@@ -165,7 +178,8 @@ namespace Breeze
             // cast widget
             QWidget* widget( static_cast<QWidget*>( object ) );
 
-            // install shadows and update winId
+            // native window changed. Install shadows on the new one
+            destroyShadows( widget );
             installShadows( widget );
 
         } else {
@@ -180,7 +194,8 @@ namespace Breeze
                     installShadows( widget );
                     break;
                 case QPlatformSurfaceEvent::SurfaceAboutToBeDestroyed:
-                    // Don't care.
+                    // native shadow must be created again for the next surface
+                    destroyShadows( widget );
                     break;
             }
         }
@@ -258,7 +273,12 @@ namespace Breeze
             QPixmap::fromImage(shadowTexture),
             innerRectTopLeft.x(),
             innerRectTopLeft.y(),
-            1, 1);
+            1, 1,
+            TileSet::Atlas);
+
+        // store texture, for platform shadow tiles
+        _shadowTexture = shadowTexture;
+        _shadowTextureCenter = innerRectTopLeft;
 
         return _shadowTiles;
     }
@@ -325,17 +345,28 @@ namespace Breeze
     {
 
         // make sure size is valid
-        if( _tiles.isEmpty() )
+        if( _tiles.isEmpty() && !_shadowTexture.isNull() )
         {
+
+            /*
+            tile rects, in logical coordinates, matching the tileset layout,
+            with a one pixel wide center
+            */
+            const QSize size( _shadowTexture.size()/_shadowTexture.devicePixelRatio() );
+            const int w1( _shadowTextureCenter.x() );
+            const int h1( _shadowTextureCenter.y() );
+            const int w3( size.width() - w1 - 1 );
+            const int h3( size.height() - h1 - 1 );
+
             _tiles = {
-                createTile( _shadowTiles.pixmap( 1 ) ),
-                createTile( _shadowTiles.pixmap( 2 ) ),
-                createTile( _shadowTiles.pixmap( 5 ) ),
-                createTile( _shadowTiles.pixmap( 8 ) ),
-                createTile( _shadowTiles.pixmap( 7 ) ),
-                createTile( _shadowTiles.pixmap( 6 ) ),
-                createTile( _shadowTiles.pixmap( 3 ) ),
-                createTile( _shadowTiles.pixmap( 0 ) )
+                createTile( QRect( w1, 0, 1, h1 ) ),
+                createTile( QRect( w1 + 1, 0, w3, h1 ) ),
+                createTile( QRect( w1 + 1, h1, w3, 1 ) ),
+                createTile( QRect( w1 + 1, h1 + 1, w3, h3 ) ),
+                createTile( QRect( w1, h1 + 1, 1, h3 ) ),
+                createTile( QRect( 0, h1 + 1, w1, h3 ) ),
+                createTile( QRect( 0, h1, w1, 1 ) ),
+                createTile( QRect( 0, 0, w1, h1 ) )
             };
         }
 
@@ -345,11 +376,16 @@ namespace Breeze
     }
 
     //______________________________________________
-    KWindowShadowTile::Ptr ShadowHelper::createTile( const QPixmap& source )
+    KWindowShadowTile::Ptr ShadowHelper::createTile( const QRect& rect ) const
     {
 
+        // copy directly from the shadow texture, in device pixels
+        const qreal dpr( _shadowTexture.devicePixelRatio() );
+        QImage image( _shadowTexture.copy( QRect( rect.topLeft()*dpr, rect.size()*dpr ) ) );
+        image.setDevicePixelRatio( dpr );
+
         KWindowShadowTile::Ptr tile = KWindowShadowTile::Ptr::create();
-        tile->setImage( source.toImage() );
+        tile->setImage( image );
         return tile;
 
     }
@@ -388,8 +424,17 @@ namespace Breeze
             connect( window, &QWindow::destroyed, this, &ShadowHelper::windowDeleted );
         }
 
+        const QMargins padding( shadowMargins( widget ) );
         if( shadow->isCreated() )
-        { shadow->destroy(); }
+        {
+
+            // nothing to do if native shadow is already installed with the same tiles
+            if( shadow->window() == window && shadow->topTile() == tiles[ 0 ] && shadow->padding() == padding )
+            { return; }
+
+            shadow->destroy();
+
+        }
 
         shadow->setTopTile( tiles[ 0 ] );
         shadow->setTopRightTile( tiles[ 1 ] );
@@ -399,11 +444,21 @@ namespace Breeze
         shadow->setBottomLeftTile( tiles[ 5 ] );
         shadow->setLeftTile( tiles[ 6 ] );
         shadow->setTopLeftTile( tiles[ 7 ] );
-        shadow->setPadding( shadowMargins( widget ) );
+        shadow->setPadding( padding );
         shadow->setWindow( window );
         shadow->create();
     }
 
+    //_______________________________________________________
+    void ShadowHelper::destroyShadows( QWidget* widget )
+    {
+        if( KWindowShadow* shadow = _shadows.value( widget->windowHandle() ) )
+        {
+            if( shadow->isCreated() )
+            { shadow->destroy(); }
+        }
+    }
+
     //_______________________________________________________
     QMargins ShadowHelper::shadowMargins( QWidget* widget ) const
     {
@@ -446,7 +501,7 @@ namespace Breeze
             }
         }
 
-        margins *= _helper.devicePixelRatio(_shadowTiles.pixmap(0));
+        margins *= _shadowTexture.devicePixelRatio();
 
         return margins;
     }
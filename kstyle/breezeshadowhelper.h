@@ -12,6 +12,8 @@
 
 #include <KWindowShadow>
 
+#include <QColor>
+#include <QImage>
 #include <QObject>
 #include <QPointer>
 #include <QMap>
@@ -59,6 +61,26 @@ namespace Breeze
         ShadowParams shadow2;
     };
 
+    //* shadow configuration, used to decide whether shadow tiles must be regenerated
+    struct ShadowConfig
+    {
+        int size = -1;
+        int strength = -1;
+        QColor color;
+        qreal devicePixelRatio = 0;
+
+        bool operator == (const ShadowConfig &other) const
+        {
+            return size == other.size
+                && strength == other.strength
+                && color == other.color
+                && devicePixelRatio == other.devicePixelRatio;
+        }
+
+        bool operator != (const ShadowConfig &other) const
+        { return !(*this == other); }
+    };
+
     //* handle shadow pixmaps passed to window manager via X property
     class ShadowHelper: public QObject
     {
@@ -123,12 +145,16 @@ namespace Breeze
         // create shared shadow tiles from tileset
         const QVector<KWindowShadowTile::Ptr>& createShadowTiles();
 
-        // create shadow tile from pixmap
-        KWindowShadowTile::Ptr createTile( const QPixmap& );
+        // create shadow tile from given rect in shadow texture
+        KWindowShadowTile::Ptr createTile( const QRect& ) const;
 
         //* installs shadow on given widget in a platform independent way
+        /** nothing is done if the native shadow is already installed with up-to-date tiles and padding */
         void installShadows( QWidget * );
 
+        //* destroys native shadow on given widget, when its native window is about to change
+        void destroyShadows( QWidget * );
+
         //* uninstalls shadow on given widget in a platform independent way
         void uninstallShadows( QWidget * );
 
@@ -146,9 +172,18 @@ namespace Breeze
         //* managed shadows
         QMap<QWindow*, KWindowShadow*> _shadows;
 
+        //* shadow configuration matching current tiles
+        ShadowConfig _config;
+
         //* tileset
         TileSet _shadowTiles;
 
+        //* shadow texture, used to generate the platform shadow tiles
+        QImage _shadowTexture;
+
+        //* shadow texture inner rect top left corner, in logical coordinates
+        QPoint _shadowTextureCenter;
+
         //* number of tiles
         enum { numTiles = 8 };
 
@@ -42,6 +42,7 @@
 #include <QItemDelegate>
 #include <QSplitterHandle>
 #include <QTextEdit>
+#include <QTimer>
 #include <QToolBar>
 #include <QToolBox>
 #include <QToolButton>
@@ -196,14 +197,35 @@ namespace Breeze
         , _toolsAreaManager ( new ToolsAreaManager( _helper, this ) )
         , _widgetExplorer( new WidgetExplorer( this ) )
         , _tabBarData( new BreezePrivate::TabBarData( this ) )
+        , _textCache( 512 )
+        , _sizeCache( 512 )
         #if BREEZE_HAVE_KSTYLE
         , SH_ArgbDndWindow( newStyleHint( QStringLiteral( "SH_ArgbDndWindow" ) ) )
         , CE_CapacityBar( newControlElement( QStringLiteral( "CE_CapacityBar" ) ) )
         #endif
     {
 
+        // DBus subscriptions are registered once the event loop runs,
+        // so that application startup does not wait on the session bus
+        QTimer::singleShot( 0, this, &Style::connectDBusSignals );
+
+        connect(qApp, &QApplication::paletteChanged, this, &Style::paletteChanged);
+
+        // cached text layouts depend on fonts
+        connect(qApp, &QGuiApplication::fontChanged, this, [this]() { _textCache.clear(); });
+        // call the slot directly; this initial call will set up things that also
+        // need to be reset when the system palette changes
+        loadConfiguration();
+
+    }
+
+    //______________________________________________________________
+    void Style::connectDBusSignals()
+    {
         // use DBus connection to update on breeze configuration change
         auto dbus = QDBusConnection::sessionBus();
+        if( !dbus.isConnected() ) return;
+
         dbus.connect( QString(),
             QStringLiteral( "/BreezeStyle" ),
             QStringLiteral( "org.kde.Breeze.Style" ),
@@ -212,7 +234,7 @@ namespace Breeze
         dbus.connect( QString(),
             QStringLiteral( "/BreezeDecoration" ),
             QStringLiteral( "org.kde.Breeze.Style" ),
-            QStringLiteral( "reparseConfiguration" ), this, SLOT(configurationChanged()) );
+            QStringLiteral( "reparseConfiguration" ), this, SLOT(decorationConfigurationChanged()) );
 
         dbus.connect( QString(),
             QStringLiteral( "/KGlobalSettings" ),
@@ -222,13 +244,7 @@ namespace Breeze
         dbus.connect( QString(),
             QStringLiteral( "/KWin" ),
             QStringLiteral( "org.kde.KWin" ),
-            QStringLiteral( "reloadConfig" ), this, SLOT(configurationChanged()));
-
-        connect(qApp, &QApplication::paletteChanged, this, &Style::configurationChanged);
-        // call the slot directly; this initial call will set up things that also
-        // need to be reset when the system palette changes
-        loadConfiguration();
-
+            QStringLiteral( "reloadConfig" ), this, SLOT(decorationConfigurationChanged()));
     }
 
     //______________________________________________________________
@@ -511,13 +527,13 @@ namespace Breeze
             if( qobject_cast<const QLineEdit*>( widget ) ) return Metrics::LineEdit_FrameWidth;
             else if( isQtQuickControl( option, widget ) )
             {
-                const QString &elementType = option->styleObject->property( "elementType" ).toString();
-                if( elementType == QLatin1String( "edit" ) || elementType == QLatin1String( "spinbox" ) )
+                const QuickElementType elementType( quickElementType( option, widget ) );
+                if( elementType == QuickEdit || elementType == QuickSpinBox )
                 {
 
                     return Metrics::LineEdit_FrameWidth;
 
-                } else if( elementType == QLatin1String( "combobox" ) ) {
+                } else if( elementType == QuickComboBox ) {
 
                     return Metrics::ComboBox_FrameWidth;
                 }
@@ -784,14 +800,14 @@ namespace Breeze
             case CT_CheckBox: return checkBoxSizeFromContents( option, size, widget );
             case CT_RadioButton: return checkBoxSizeFromContents( option, size, widget );
             case CT_LineEdit: return lineEditSizeFromContents( option, size, widget );
-            case CT_ComboBox: return comboBoxSizeFromContents( option, size, widget );
+            case CT_ComboBox: return cachedSizeFromContents( element, option, size, widget );
             case CT_SpinBox: return spinBoxSizeFromContents( option, size, widget );
             case CT_Slider: return sliderSizeFromContents( option, size, widget );
-            case CT_PushButton: return pushButtonSizeFromContents( option, size, widget );
-            case CT_ToolButton: return toolButtonSizeFromContents( option, size, widget );
+            case CT_PushButton: return cachedSizeFromContents( element, option, size, widget );
+            case CT_ToolButton: return cachedSizeFromContents( element, option, size, widget );
             case CT_MenuBar: return defaultSizeFromContents( option, size, widget );
             case CT_MenuBarItem: return menuBarItemSizeFromContents( option, size, widget );
-            case CT_MenuItem: return menuItemSizeFromContents( option, size, widget );
+            case CT_MenuItem: return cachedSizeFromContents( element, option, size, widget );
             case CT_ProgressBar: return progressBarSizeFromContents( option, size, widget );
             case CT_TabWidget: return tabWidgetSizeFromContents( option, size, widget );
             case CT_TabBarTab: return tabBarTabSizeFromContents( option, size, widget );
@@ -804,6 +820,111 @@ namespace Breeze
 
     }
 
+    //______________________________________________________________
+    QSize Style::cachedSizeFromContents( ContentsType element, const QStyleOption* option, const QSize& size, const QWidget* widget ) const
+    {
+
+        // lookup cache, for controls whose size depends on text measurement
+        SizeCacheKey key;
+        const bool cacheable( sizeCacheKey( element, option, size, widget, key ) );
+        if( cacheable )
+        { if( const QSize* cached = _sizeCache.object( key ) ) return *cached; }
+
+        QSize result;
+        switch( element )
+        {
+            case CT_PushButton: result = pushButtonSizeFromContents( option, size, widget ); break;
+            case CT_ToolButton: result = toolButtonSizeFromContents( option, size, widget ); break;
+            case CT_ComboBox: result = comboBoxSizeFromContents( option, size, widget ); break;
+            case CT_MenuItem: result = menuItemSizeFromContents( option, size, widget ); break;
+            default: return size;
+        }
+
+        if( cacheable ) _sizeCache.insert( key, new QSize( result ) );
+        return result;
+
+    }
+
+    //______________________________________________________________
+    bool Style::sizeCacheKey( ContentsType element, const QStyleOption* option, const QSize& contentsSize, const QWidget* widget, SizeCacheKey& key ) const
+    {
+
+        // font is only known when option font metrics are those of the widget
+        auto hasWidgetFont = [option, widget]() { return widget && option->fontMetrics == widget->fontMetrics(); };
+
+        switch( element )
+        {
+
+            case CT_PushButton:
+            {
+                const auto buttonOption( qstyleoption_cast<const QStyleOptionButton*>( option ) );
+                if( !buttonOption || buttonOption->text.isEmpty() || !hasWidgetFont() ) return false;
+
+                key = { element, contentsSize, buttonOption->text, widget->font(), buttonOption->iconSize, !buttonOption->icon.isNull(), int( buttonOption->features ), 0, 0, 0, 0, 0 };
+                return true;
+            }
+
+            case CT_ToolButton:
+            {
+                // size does not depend on text and font, only on which parts are present
+                const auto toolButtonOption( qstyleoption_cast<const QStyleOptionToolButton*>( option ) );
+                if( !toolButtonOption ) return false;
+
+                const int flags( ( option->state & State_AutoRaise ? 1:0 ) | ( toolButtonOption->text.isEmpty() ? 2:0 ) );
+                key = { element, contentsSize, QString(), QFont(), QSize(), !toolButtonOption->icon.isNull(), int( toolButtonOption->features ), int( toolButtonOption->toolButtonStyle ), 0, 0, 0, flags };
+                return true;
+            }
+
+            case CT_ComboBox:
+            {
+                const auto comboBoxOption( qstyleoption_cast<const QStyleOptionComboBox*>( option ) );
+                if( !comboBoxOption ) return false;
+
+                const int flags( ( comboBoxOption->frame ? 1:0 ) | ( comboBoxOption->editable ? 2:0 ) );
+                key = { element, contentsSize, QString(), QFont(), QSize(), false, 0, 0, 0, 0, 0, flags };
+                return true;
+            }
+
+            case CT_MenuItem:
+            {
+                const auto menuItemOption( qstyleoption_cast<const QStyleOptionMenuItem*>( option ) );
+                if( !menuItemOption ) return false;
+
+                switch( menuItemOption->menuItemType )
+                {
+                    case QStyleOptionMenuItem::Normal:
+                    case QStyleOptionMenuItem::DefaultItem:
+                    case QStyleOptionMenuItem::SubMenu:
+                    {
+                        // icon width differs for Qt Quick menus. The font is not used
+                        if( !widget ) return false;
+                        break;
+                    }
+
+                    case QStyleOptionMenuItem::Separator:
+                    {
+                        // only separators with text are costly
+                        if( menuItemOption->text.isEmpty() || !hasWidgetFont() ) return false;
+                        break;
+                    }
+
+                    default: return false;
+                }
+
+                const bool separator( menuItemOption->menuItemType == QStyleOptionMenuItem::Separator );
+                key = {
+                    element, contentsSize, menuItemOption->text, separator ? widget->font() : QFont(), QSize(),
+                    !menuItemOption->icon.isNull(), 0, int( menuItemOption->menuItemType ), int( menuItemOption->checkType ),
+                    menuItemOption->tabWidth, menuItemOption->maxIconWidth, menuItemOption->menuHasCheckableItems ? 1:0 };
+                return true;
+            }
+
+            default: return false;
+
+        }
+
+    }
+
     //______________________________________________________________
     QStyle::SubControl Style::hitTestComplexControl( ComplexControl control, const QStyleOptionComplex* option, const QPoint& point, const QWidget* widget ) const
     {
@@ -1048,6 +1169,13 @@ namespace Breeze
         const QString &text, QPalette::ColorRole textRole ) const
     {
 
+        // register widgets rendering mnemonics, for targeted repaint when their visibility changes
+        if( _mnemonics->isTracking() &&
+            ( flags&( Qt::TextShowMnemonic|Qt::TextHideMnemonic ) ) &&
+            painter->device() && painter->device()->devType() == QInternal::Widget &&
+            text.contains( QLatin1Char( '&' ) ) )
+        { _mnemonics->registerWidget( static_cast<QWidget*>( painter->device() ), painter->transform().mapRect( rect ) ); }
+
         // hide mnemonics if requested
         if( !_mnemonics->enabled() && ( flags&Qt::TextShowMnemonic ) && !( flags&Qt::TextHideMnemonic ) )
         {
@@ -1078,11 +1206,65 @@ namespace Breeze
 
         }
 
+        // use cached layout when possible
+        if( enabled && drawCachedItemText( painter, rect, flags, palette, text, textRole ) ) return;
+
         // fallback
         return ParentStyleClass::drawItemText( painter, rect, flags, palette, enabled, text, textRole );
 
     }
 
+    //______________________________________________________________
+    bool Style::drawCachedItemText(
+        QPainter* painter, const QRect& rect, int flags, const QPalette& palette,
+        const QString &text, QPalette::ColorRole textRole ) const
+    {
+
+        // only single line, left to right plain text without mnemonics is cached.
+        // Anything else goes through QCommonStyle, whose alignment is mirrored below for this case only
+        if( text.isEmpty() || painter->layoutDirection() != Qt::LeftToRight || text.isRightToLeft() ) return false;
+        if( flags & ( Qt::TextWordWrap|Qt::TextWrapAnywhere|Qt::TextExpandTabs|Qt::TextJustificationForced|Qt::AlignJustify ) ) return false;
+        foreach( const QChar& c, text )
+        {
+            if( c == QLatin1Char( '&' ) || c == QLatin1Char( '\n' ) || c == QLatin1Char( '\t' ) || c == QChar::LineSeparator )
+            { return false; }
+        }
+
+        // lookup cache
+        const QPaintDevice* device( painter->device() );
+        if( !device ) return false;
+        const TextCacheKey key = { text, painter->font(), device->logicalDpiY(), device->devicePixelRatioF() };
+        QStaticText* staticText( _textCache.object( key ) );
+        if( !staticText )
+        {
+            staticText = new QStaticText( text );
+            staticText->setTextFormat( Qt::PlainText );
+            staticText->prepare( QTransform(), painter->font() );
+            _textCache.insert( key, staticText );
+        }
+
+        // text that does not fit is clipped by the default implementation
+        const QSizeF size( staticText->size() );
+        if( size.width() > rect.width() || size.height() > rect.height() ) return false;
+
+        // alignment
+        QPointF position( rect.topLeft() );
+        if( flags & Qt::AlignRight ) position.rx() += rect.width() - size.width();
+        else if( flags & Qt::AlignHCenter ) position.rx() += ( rect.width() - size.width() )/2;
+
+        if( flags & Qt::AlignBottom ) position.ry() += rect.height() - size.height();
+        else if( flags & Qt::AlignVCenter ) position.ry() += ( rect.height() - size.height() )/2;
+
+        // pen, same as QStyle::drawItemText
+        const QPen savedPen( painter->pen() );
+        if( textRole != QPalette::NoRole ) painter->setPen( QPen( palette.brush( textRole ), savedPen.widthF() ) );
+        painter->drawStaticText( position, *staticText );
+        if( textRole != QPalette::NoRole ) painter->setPen( savedPen );
+
+        return true;
+
+    }
+
     //_____________________________________________________________________
     bool Style::eventFilter( QObject *object, QEvent *event )
     {
@@ -1091,7 +1273,7 @@ namespace Breeze
         else if( auto subWindow = qobject_cast<QMdiSubWindow*>( object ) ) { return eventFilterMdiSubWindow( subWindow, event ); }
         else if( auto commandLinkButton = qobject_cast<QCommandLinkButton*>( object ) ) { return eventFilterCommandLinkButton( commandLinkButton, event ); }
         #if QT_VERSION < 0x050D00 // Check if Qt version < 5.13
-        else if( object == qApp && event->type() == QEvent::ApplicationPaletteChange ) { configurationChanged(); }
+        else if( object == qApp && event->type() == QEvent::ApplicationPaletteChange ) { paletteChanged(); }
         #endif
         // cast to QWidget
         QWidget *widget = static_cast<QWidget*>( object );
@@ -1413,12 +1595,136 @@ namespace Breeze
     //_____________________________________________________________________
     void Style::configurationChanged()
     {
+        // a single change usually triggers several notifications, handle them once
+        if( !_configurationTimer.isActive() ) _configurationTimer.start( 50, this );
+    }
+
+    //_____________________________________________________________________
+    void Style::timerEvent( QTimerEvent* event )
+    {
+        if( event->timerId() == _configurationTimer.timerId() )
+        {
+
+            _configurationTimer.stop();
+            reloadConfiguration();
+
+        } else ParentStyleClass::timerEvent( event );
+    }
+
+    //_____________________________________________________________________
+    void Style::decorationConfigurationChanged()
+    {
+        _helperConfigurationChanged = true;
+        configurationChanged();
+    }
+
+    //_____________________________________________________________________
+    void Style::reloadConfiguration()
+    {
+
+        // store current values, for comparison
+        const ConfigurationValues previous( configurationValues() );
 
         // reload
         StyleConfigData::self()->load();
+        loadGlobalAnimationSettings();
+        loadGlobalSettings();
 
-        // reload configuration
-        loadConfiguration();
+        const ConfigurationValues current( configurationValues() );
+        const bool helperChanged( _helperConfigurationChanged );
+        _helperConfigurationChanged = false;
+
+        // nothing to do
+        if( !helperChanged && previous == current ) return;
+
+        auto changed = [&previous, &current]( const QStringList& names )
+        {
+            foreach( const QString& name, names )
+            { if( previous.value( name ) != current.value( name ) ) return true; }
+            return false;
+        };
+
+        // kwin and decoration settings
+        if( helperChanged )
+        {
+            _helper->loadConfig();
+            _iconCache.clear();
+        }
+
+        // animations
+        if( changed( {
+            QStringLiteral( "AnimationsEnabled" ),
+            QStringLiteral( "AnimationSteps" ),
+            QStringLiteral( "AnimationsDuration" ),
+            QStringLiteral( "StackedWidgetTransitionsEnabled" ),
+            QStringLiteral( "ProgressBarAnimated" ),
+            QStringLiteral( "ProgressBarBusyStepDuration" ) } ) )
+        { _animations->setupEngines(); }
+
+        // window drag
+        if( changed( {
+            QStringLiteral( "WindowDragMode" ),
+            QStringLiteral( "WindowDragWhiteList" ),
+            QStringLiteral( "WindowDragBlackList" ) } ) )
+        { _windowManager->initialize(); }
+
+        // mnemonics
+        if( changed( { QStringLiteral( "MnemonicsMode" ) } ) )
+        { _mnemonics->setMode( StyleConfigData::mnemonicsMode() ); }
+
+        // splitter proxy
+        if( changed( { QStringLiteral( "SplitterProxyEnabled" ) } ) )
+        { _splitterFactory->setEnabled( StyleConfigData::splitterProxyEnabled() ); }
+
+        // shadows
+        if( changed( {
+            QStringLiteral( "ShadowSize" ),
+            QStringLiteral( "ShadowStrength" ),
+            QStringLiteral( "ShadowColor" ) } ) )
+        {
+            _shadowHelper->loadConfig();
+            _mdiWindowShadowFactory->setShadowHelper( _shadowHelper );
+        }
+
+        // menu translucency
+        if( changed( { QStringLiteral( "MenuOpacity" ) } ) )
+        {
+            foreach( QWidget* widget, QApplication::topLevelWidgets() )
+            {
+                if( !qobject_cast<QMenu*>( widget ) ) continue;
+                if( _helper->hasAlphaChannel( widget ) && StyleConfigData::menuOpacity() < 100 ) _blurHelper->registerWidget( widget );
+                else _blurHelper->unregisterWidget( widget );
+                widget->update();
+            }
+        }
+
+        // remaining options may change sizes
+        _sizeCache.clear();
+        loadOptions();
+
+    }
+
+    //_____________________________________________________________________
+    Style::ConfigurationValues Style::configurationValues() const
+    {
+        ConfigurationValues values;
+        foreach( const KConfigSkeletonItem* item, StyleConfigData::self()->items() )
+        { values.insert( item->name(), item->property() ); }
+
+        // global settings
+        values.insert( QStringLiteral( "ShowIconsInMenuItems" ), _showIconsInMenuItems );
+        values.insert( QStringLiteral( "ShowIconsOnPushButtons" ), _showIconsOnPushButtons );
+
+        return values;
+    }
+
+    //_____________________________________________________________________
+    void Style::paletteChanged()
+    {
+
+        // colors must be up to date before widgets are repainted, this is not delayed
+        _helper->loadConfig();
+        _iconCache.clear();
 
     }
 
@@ -1442,6 +1748,15 @@ namespace Breeze
         }
     }
 
+    //_____________________________________________________________________
+    void Style::loadGlobalSettings()
+    {
+        // stored so that paint and size computations never read the configuration
+        const KConfigGroup cg(KSharedConfig::openConfig(), QStringLiteral("KDE"));
+        _showIconsInMenuItems = cg.readEntry("ShowIconsInMenuItems", true);
+        _showIconsOnPushButtons = cg.readEntry("ShowIconsOnPushButtons", true);
+    }
+
     //_____________________________________________________________________
     void Style::globalConfigurationChanged(int type, int arg)
     {
@@ -1513,6 +1828,7 @@ namespace Breeze
         _helper->loadConfig();
 
         loadGlobalAnimationSettings();
+        loadGlobalSettings();
 
         // reinitialize engines
         _animations->setupEngines();
@@ -1530,9 +1846,17 @@ namespace Breeze
         // set mdiwindow factory shadow tiles
         _mdiWindowShadowFactory->setShadowHelper( _shadowHelper );
 
-        // clear icon cache
+        // clear icon, text and size caches
         _iconCache.clear();
+        _textCache.clear();
+        _sizeCache.clear();
 
+        loadOptions();
+    }
+
+    //_____________________________________________________________________
+    void Style::loadOptions()
+    {
         // scrollbar buttons
         switch( StyleConfigData::scrollBarAddLineButtons() )
         {
@@ -3105,7 +3429,7 @@ namespace Breeze
         if( !isTitleWidget && !( state & (State_Sunken | State_Raised ) ) ) return true;
 
         const bool isInputWidget( ( widget && widget->testAttribute( Qt::WA_Hover ) ) ||
-            ( isQtQuickControl( option, widget ) && option->styleObject->property( "elementType" ).toString() == QStringLiteral( "edit") ) );
+            quickElementType( option, widget ) == QuickEdit );
 
         const bool enabled( state & State_Enabled );
         const bool mouseOver( enabled && isInputWidget && ( state & State_MouseOver ) );
@@ -3205,7 +3529,7 @@ namespace Breeze
         if (widget && widget->inherits("QComboBoxListView"))
         { return true; }
 
-        if ( option->styleObject && option->styleObject->property("elementType") == QLatin1String("button") )
+        if ( quickElementType( option, widget ) == QuickButton )
         { return true; }
 
         const State& state( option->state );
@@ -6794,8 +7118,12 @@ namespace Breeze
         // update mouse-over effect
         const bool mouseOver( enabled && ( state & State_MouseOver ) );
 
+        // arrow rect
+        const auto arrowRect( subControlRect( CC_SpinBox, option, subControl, widget ) );
+
         // check animation state
         const bool subControlHover( enabled && mouseOver && ( option->activeSubControls & subControl ) );
+        _animations->spinBoxEngine().setSubControlRect( widget, subControl, arrowRect );
         _animations->spinBoxEngine().updateState( widget, subControl, subControlHover );
 
         const bool animated( enabled && _animations->spinBoxEngine().isAnimated( widget, subControl ) );
@@ -6821,9 +7149,6 @@ namespace Breeze
         // arrow orientation
         ArrowOrientation orientation( ( subControl == SC_SpinBoxUp ) ? ArrowUp:ArrowDown );
 
-        // arrow rect
-        const auto arrowRect( subControlRect( CC_SpinBox, option, subControl, widget ) );
-
         // render
         _helper->renderArrow( painter, arrowRect, color, orientation );
 
@@ -7232,9 +7557,28 @@ namespace Breeze
     bool Style::isQtQuickControl( const QStyleOption* option, const QWidget* widget ) const
     {
         #if BREEZE_HAVE_QTQUICK
-        const bool is = (widget == nullptr) && option && option->styleObject && option->styleObject->inherits( "QQuickItem" );
-        if ( is ) _windowManager->registerQuickItem( static_cast<QQuickItem*>( option->styleObject ) );
-        return is;
+        if( widget || !option || !option->styleObject ) return false;
+
+        // classify style object class, once
+        QObject* object( option->styleObject );
+        const QMetaObject* metaObject( object->metaObject() );
+        auto iter( _quickClasses.constFind( metaObject ) );
+        if( iter == _quickClasses.constEnd() )
+        { iter = _quickClasses.insert( metaObject, metaObject->inherits( &QQuickItem::staticMetaObject ) ); }
+
+        if( !iter.value() ) return false;
+
+        // register to window manager, unless already done for this window
+        auto item( static_cast<QQuickItem*>( object ) );
+        auto window( item->window() );
+        if( window && !_quickWindows.contains( window ) )
+        {
+            _windowManager->registerQuickItem( item );
+            _quickWindows.insert( window );
+            connect( window, &QObject::destroyed, const_cast<Style*>( this ), [this]( QObject* object ) { _quickWindows.remove( object ); } );
+        }
+
+        return true;
         #else
         Q_UNUSED( widget );
         Q_UNUSED( option );
@@ -7243,17 +7587,26 @@ namespace Breeze
     }
 
     //____________________________________________________________________
-    bool Style::showIconsInMenuItems() const
+    Style::QuickElementType Style::quickElementType( const QStyleOption* option, const QWidget* widget ) const
     {
-        const KConfigGroup g(KSharedConfig::openConfig(), "KDE");
-        return g.readEntry("ShowIconsInMenuItems", true);
-    }
+        if( !isQtQuickControl( option, widget ) ) return QuickOther;
 
-    //____________________________________________________________________
-    bool Style::showIconsOnPushButtons() const
-    {
-        const KConfigGroup g(KSharedConfig::openConfig(), "KDE");
-        return g.readEntry("ShowIconsOnPushButtons", true);
+        // lookup cache
+        QObject* object( option->styleObject );
+        auto iter( _quickElementTypes.constFind( object ) );
+        if( iter != _quickElementTypes.constEnd() ) return iter.value();
+
+        // classify
+        QuickElementType type( QuickOther );
+        const QString elementType( object->property( "elementType" ).toString() );
+        if( elementType == QLatin1String( "edit" ) ) type = QuickEdit;
+        else if( elementType == QLatin1String( "spinbox" ) ) type = QuickSpinBox;
+        else if( elementType == QLatin1String( "combobox" ) ) type = QuickComboBox;
+        else if( elementType == QLatin1String( "button" ) ) type = QuickButton;
+
+        _quickElementTypes.insert( object, type );
+        connect( object, &QObject::destroyed, const_cast<Style*>( this ), [this]( QObject* object ) { _quickElementTypes.remove( object ); } );
+        return type;
     }
 
     //____________________________________________________________________
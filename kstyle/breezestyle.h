@@ -18,6 +18,8 @@
 
 #include <QAbstractItemView>
 #include <QAbstractScrollArea>
+#include <QBasicTimer>
+#include <QCache>
 
 #include <QCommandLinkButton>
 #include <QCommonStyle>
@@ -25,6 +27,8 @@
 #include <QHash>
 #include <QIcon>
 #include <QMdiSubWindow>
+#include <QSet>
+#include <QStaticText>
 #include <QStyleOption>
 #include <QWidget>
 
@@ -143,9 +147,18 @@ namespace Breeze
 
         protected Q_SLOTS:
 
-        //* update configuration
+        //* update configuration. Reload is delayed, to coalesce change notifications
         void configurationChanged();
 
+        //* kwin or decoration configuration changed. Helper is reloaded with the delayed configuration
+        void decorationConfigurationChanged();
+
+        //* update colors, immediately
+        void paletteChanged();
+
+        //* subscribe to configuration change DBus signals
+        void connectDBusSignals();
+
         //* global configuration changed
         void globalConfigurationChanged(int type, int arg);
         void loadGlobalAnimationSettings();
@@ -155,6 +168,9 @@ namespace Breeze
 
         protected:
 
+        //* timer event, used to delay configuration reload
+        void timerEvent( QTimerEvent* ) override;
+
         //* standard icons
         QIcon standardIcon( StandardPixmap pixmap, const QStyleOption* option = nullptr, const QWidget* widget = nullptr) const override
         { return standardIconImplementation( pixmap, option, widget ); }
@@ -164,6 +180,78 @@ namespace Breeze
         //* load configuration
         void loadConfiguration();
 
+        //* sizeFromContents cache key
+        struct SizeCacheKey
+        {
+            int type;
+            QSize contentsSize;
+            QString text;
+            QFont font;
+            QSize iconSize;
+            bool hasIcon;
+            int features;
+
+            //* menu item type, or tool button style
+            int itemType;
+
+            //*@name menu item fields
+            //@{
+            int checkType;
+            int tabWidth;
+            int maxIconWidth;
+            //@}
+
+            //* state and frame flags, that depend on the contents type
+            int flags;
+
+            bool operator == ( const SizeCacheKey& other ) const
+            {
+                return type == other.type
+                    && contentsSize == other.contentsSize
+                    && text == other.text
+                    && font == other.font
+                    && iconSize == other.iconSize
+                    && hasIcon == other.hasIcon
+                    && features == other.features
+                    && itemType == other.itemType
+                    && checkType == other.checkType
+                    && tabWidth == other.tabWidth
+                    && maxIconWidth == other.maxIconWidth
+                    && flags == other.flags;
+            }
+
+        };
+
+        friend uint qHash( const SizeCacheKey& key, uint seed )
+        {
+            return qHash( key.text, seed )
+                ^ qHash( key.font, seed )
+                ^ qHash( ( key.contentsSize.width() << 16 ) ^ key.contentsSize.height(), seed )
+                ^ qHash( ( key.iconSize.width() << 16 ) ^ key.iconSize.height(), seed )
+                ^ qHash( ( key.type << 16 ) ^ ( key.features << 1 ) ^ int( key.hasIcon ), seed )
+                ^ qHash( ( key.itemType << 24 ) ^ ( key.checkType << 16 ) ^ ( key.flags << 8 ), seed )
+                ^ qHash( ( key.tabWidth << 16 ) ^ key.maxIconWidth, seed );
+        }
+
+        //* sizeFromContents for buttons, combo boxes and menu items, using cache when possible
+        QSize cachedSizeFromContents( ContentsType, const QStyleOption*, const QSize&, const QWidget* ) const;
+
+        //* build sizeFromContents cache key. Returns false if size cannot be cached
+        bool sizeCacheKey( ContentsType, const QStyleOption*, const QSize&, const QWidget*, SizeCacheKey& ) const;
+
+        //* render single line, plain text using cached layout. Returns false if text cannot be cached
+        bool drawCachedItemText( QPainter*, const QRect&, int flags, const QPalette&, const QString&, QPalette::ColorRole ) const;
+
+        //* reload configuration, and only update what changed
+        void reloadConfiguration();
+
+        //* load options that are cheap to update
+        void loadOptions();
+
+        //* configuration values, by entry name
+        using ConfigurationValues = QHash<QString, QVariant>;
+        ConfigurationValues configurationValues() const;
+
         //*@name subelementRect specialized functions
         //@{
 
@@ -390,6 +478,19 @@ namespace Breeze
         //* return true if option corresponds to QtQuick control
         bool isQtQuickControl( const QStyleOption*, const QWidget* ) const;
 
+        //* Qt Quick control element type
+        enum QuickElementType
+        {
+            QuickOther,
+            QuickEdit,
+            QuickSpinBox,
+            QuickComboBox,
+            QuickButton
+        };
+
+        //* return element type of QtQuick control, classified once per style object
+        QuickElementType quickElementType( const QStyleOption*, const QWidget* ) const;
+
         //@}
 
         //* adjust rect based on provided margins
@@ -450,10 +551,15 @@ namespace Breeze
         template<typename T> bool hasParent( const QWidget* ) const;
 
         //* return true if icons should be shown in menus
-        bool showIconsInMenuItems() const;
+        bool showIconsInMenuItems() const
+        { return _showIconsInMenuItems; }
 
         //* return true if icons should be shown on buttons
-        bool showIconsOnPushButtons() const;
+        bool showIconsOnPushButtons() const
+        { return _showIconsOnPushButtons; }
+
+        //* load KDE global settings used when rendering
+        void loadGlobalSettings();
 
         //* return true if passed widget is a menu title (KMenu::addTitle)
         bool isMenuTitle( const QWidget* ) const;
@@ -510,6 +616,62 @@ namespace Breeze
         //* tabbar data
         BreezePrivate::TabBarData* _tabBarData = nullptr;
 
+        //* delay configuration reload, to coalesce change notifications
+        QBasicTimer _configurationTimer;
+
+        //* true if helper configuration must be reloaded with the delayed configuration
+        bool _helperConfigurationChanged = false;
+
+        //* laid out text, by string and font
+        /**
+        QFont comparison ignores the resolution the font was resolved for,
+        so the painter device resolution and pixel ratio are stored too
+        */
+        struct TextCacheKey
+        {
+            QString text;
+            QFont font;
+            int dpi;
+            qreal devicePixelRatio;
+
+            bool operator == ( const TextCacheKey& other ) const
+            {
+                return text == other.text
+                    && font == other.font
+                    && dpi == other.dpi
+                    && qFuzzyCompare( devicePixelRatio, other.devicePixelRatio );
+            }
+
+        };
+
+        friend uint qHash( const TextCacheKey& key, uint seed )
+        {
+            return qHash( key.text, seed )
+                ^ qHash( key.font, seed )
+                ^ qHash( ( key.dpi << 8 ) ^ qRound( key.devicePixelRatio*100 ), seed );
+        }
+
+        using TextCache = QCache<TextCacheKey, QStaticText>;
+        mutable TextCache _textCache;
+
+        //* sizeFromContents results, for controls with text
+        mutable QCache<SizeCacheKey, QSize> _sizeCache;
+
+        //* Qt Quick classification of style objects, per class
+        mutable QHash<const QMetaObject*, bool> _quickClasses;
+
+        //* Qt Quick windows registered to the window manager
+        mutable QSet<const QObject*> _quickWindows;
+
+        //* Qt Quick element types, per style object
+        mutable QHash<const QObject*, QuickElementType> _quickElementTypes;
+
+        //*@name KDE global settings
+        //@{
+        bool _showIconsInMenuItems = true;
+        bool _showIconsOnPushButtons = true;
+        //@}
+
         //* icon hash
         using IconCache = QHash<StandardPixmap, QIcon>;
         IconCache _iconCache;
@@ -70,7 +70,8 @@ namespace Breeze
     { _pixmaps.reserve(9); }
 
     //______________________________________________________________
-    TileSet::TileSet(const QPixmap &source, int w1, int h1, int w2, int h2 ):
+    TileSet::TileSet(const QPixmap &source, int w1, int h1, int w2, int h2, StorageMode mode ):
+        _mode(mode),
         _w1(w1),
         _h1(h1),
         _w3(0),
@@ -79,11 +80,87 @@ namespace Breeze
         _pixmaps.reserve(9);
         if( source.isNull() ) return;
 
-        _w3 = source.width()/devicePixelRatio( source ) - (w1 + w2);
-        _h3 = source.height()/devicePixelRatio( source ) - (h1 + h2);
+        _devicePixelRatio = devicePixelRatio( source );
+        _w3 = source.width()/_devicePixelRatio - (w1 + w2);
+        _h3 = source.height()/_devicePixelRatio - (h1 + h2);
         int w = w2;
         int h = h2;
 
+        if( _mode == Atlas )
+        {
+
+            // chunk rects in source, scaled to device pixels
+            const qreal dpiRatio( _devicePixelRatio );
+            const int widths[3] = { qRound( _w1*dpiRatio ), qRound( w2*dpiRatio ), qRound( _w3*dpiRatio ) };
+            const int heights[3] = { qRound( _h1*dpiRatio ), qRound( h2*dpiRatio ), qRound( _h3*dpiRatio ) };
+
+            /*
+            chunks are copied to the atlas with a one pixel gutter around each of them,
+            in which their edges are replicated. This prevents smooth scaling with fractional
+            device pixel ratios from sampling neighbouring chunks
+            */
+            const int gutter( 1 );
+            const QSize atlasSize(
+                widths[0] + widths[1] + widths[2] + 6*gutter,
+                heights[0] + heights[1] + heights[2] + 6*gutter );
+
+            _atlas = QPixmap( atlasSize );
+            _atlas.fill( Qt::transparent );
+
+            QPainter painter( &_atlas );
+            painter.setCompositionMode( QPainter::CompositionMode_Source );
+
+            _sourceRects.reserve(9);
+            int sourceY( 0 );
+            int targetY( gutter );
+            for( int row = 0; row < 3; ++row )
+            {
+
+                int sourceX( 0 );
+                int targetX( gutter );
+                for( int column = 0; column < 3; ++column )
+                {
+
+                    const QRect sourceRect( sourceX, sourceY, widths[column], heights[row] );
+                    const QRect targetRect( targetX, targetY, widths[column], heights[row] );
+                    if( targetRect.isValid() )
+                    {
+
+                        // replicate edges in gutter
+                        const int w( targetRect.width() );
+                        const int h( targetRect.height() );
+                        painter.drawPixmap( QRect( targetRect.left(), targetRect.top() - gutter, w, gutter ), source, QRect( sourceRect.left(), sourceRect.top(), w, 1 ) );
+                        painter.drawPixmap( QRect( targetRect.left(), targetRect.bottom() + 1, w, gutter ), source, QRect( sourceRect.left(), sourceRect.bottom(), w, 1 ) );
+                        painter.drawPixmap( QRect( targetRect.left() - gutter, targetRect.top(), gutter, h ), source, QRect( sourceRect.left(), sourceRect.top(), 1, h ) );
+                        painter.drawPixmap( QRect( targetRect.right() + 1, targetRect.top(), gutter, h ), source, QRect( sourceRect.right(), sourceRect.top(), 1, h ) );
+                        painter.drawPixmap( QRect( targetRect.left() - gutter, targetRect.top() - gutter, gutter, gutter ), source, QRect( sourceRect.topLeft(), QSize( 1, 1 ) ) );
+                        painter.drawPixmap( QRect( targetRect.right() + 1, targetRect.top() - gutter, gutter, gutter ), source, QRect( sourceRect.topRight(), QSize( 1, 1 ) ) );
+                        painter.drawPixmap( QRect( targetRect.left() - gutter, targetRect.bottom() + 1, gutter, gutter ), source, QRect( sourceRect.bottomLeft(), QSize( 1, 1 ) ) );
+                        painter.drawPixmap( QRect( targetRect.right() + 1, targetRect.bottom() + 1, gutter, gutter ), source, QRect( sourceRect.bottomRight(), QSize( 1, 1 ) ) );
+
+                        // chunk
+                        painter.drawPixmap( targetRect, source, sourceRect );
+
+                    }
+
+                    _sourceRects.append( QRectF( targetRect ) );
+                    sourceX += widths[column];
+                    targetX += widths[column] + 2*gutter;
+
+                }
+
+                sourceY += heights[row];
+                targetY += heights[row] + 2*gutter;
+
+            }
+
+            painter.end();
+            setDevicePixelRatio( _atlas, dpiRatio );
+
+            return;
+
+        }
+
         // initialise pixmap array
         initPixmap( _pixmaps, source, _w1, _h1, QRect(0, 0, _w1, _h1) );
         initPixmap( _pixmaps, source, w, _h1, QRect(_w1, 0, w2, _h1) );
@@ -96,16 +173,26 @@ namespace Breeze
         initPixmap( _pixmaps, source, _w3, _h3, QRect(_w1+w2, _h1+h2, _w3, _h3) );
     }
 
+    //______________________________________________________________
+    QPixmap TileSet::pixmap( int index ) const
+    {
+        if( _mode == Pixmaps ) return _pixmaps[index];
+
+        QPixmap pixmap( _atlas.copy( _sourceRects[index].toRect() ) );
+        setDevicePixelRatio( pixmap, _devicePixelRatio );
+        return pixmap;
+    }
+
     //___________________________________________________________
     void TileSet::render(const QRect &constRect, QPainter *painter, Tiles tiles) const
     {
 
+        // check initialization
+        if( !isValid() ) return;
+
         const bool oldHint( painter->testRenderHint( QPainter::SmoothPixmapTransform ) );
         painter->setRenderHint( QPainter::SmoothPixmapTransform, true );
 
-        // check initialization
-        if( _pixmaps.size() < 9 ) return;
-
         // copy source rect
         QRect rect( constRect );
 
@@ -133,6 +220,14 @@ namespace Breeze
             hBottom = (tiles&Top) ? qMin( _h3, int(h*(1.0-hRatio)) ):_h3;
         }
 
+        // atlas
+        if( _mode == Atlas )
+        {
+            renderAtlas( painter, tiles, rect, wLeft, wRight, hTop, hBottom );
+            painter->setRenderHint( QPainter::SmoothPixmapTransform, oldHint );
+            return;
+        }
+
         // calculate corner locations
         w -= wLeft + wRight;
         h -= hTop + hBottom;
@@ -172,4 +267,64 @@ namespace Breeze
 
     }
 
+    //___________________________________________________________
+    void TileSet::renderAtlas( QPainter* painter, Tiles tiles, const QRect& rect, int wLeft, int wRight, int hTop, int hBottom ) const
+    {
+
+        // calculate corner locations
+        const int w = rect.width() - (wLeft + wRight);
+        const int h = rect.height() - (hTop + hBottom);
+        const int x0 = rect.x();
+        const int y0 = rect.y();
+        const int x1 = x0 + wLeft;
+        const int x2 = x1 + w;
+        const int y1 = y0 + hTop;
+        const int y2 = y1 + h;
+
+        const qreal dpr( _devicePixelRatio );
+        const qreal w2( _sourceRects[7].width() );
+        const qreal h2( _sourceRects[5].height() );
+
+        QPainter::PixmapFragment fragments[9];
+        int count( 0 );
+
+        // add fragment drawing given part of chunk, in device pixels, to given target rect
+        auto addFragment = [&]( int index, const QRectF& target, qreal dx, qreal dy, qreal sourceWidth, qreal sourceHeight )
+        {
+            if( target.isEmpty() || sourceWidth <= 0 || sourceHeight <= 0 ) return;
+            const QRectF& chunk( _sourceRects[index] );
+            const QRectF source( chunk.x() + dx, chunk.y() + dy, sourceWidth, sourceHeight );
+            fragments[count++] = QPainter::PixmapFragment::create(
+                target.center(), source,
+                target.width()/source.width(), target.height()/source.height() );
+        };
+
+        // corners
+        if( bits( tiles, Top|Left) ) addFragment( 0, QRectF( x0, y0, wLeft, hTop ), 0, 0, wLeft*dpr, hTop*dpr );
+        if( bits( tiles, Top|Right) ) addFragment( 2, QRectF( x2, y0, wRight, hTop ), (_w3-wRight)*dpr, 0, wRight*dpr, hTop*dpr );
+        if( bits( tiles, Bottom|Left) ) addFragment( 6, QRectF( x0, y2, wLeft, hBottom ), 0, (_h3-hBottom)*dpr, wLeft*dpr, hBottom*dpr );
+        if( bits( tiles, Bottom|Right) ) addFragment( 8, QRectF( x2, y2, wRight, hBottom ), (_w3-wRight)*dpr, (_h3-hBottom)*dpr, wRight*dpr, hBottom*dpr );
+
+        // top and bottom
+        if( w > 0 )
+        {
+            if( tiles&Top ) addFragment( 1, QRectF( x1, y0, w, hTop ), 0, 0, w2, hTop*dpr );
+            if( tiles&Bottom ) addFragment( 7, QRectF( x1, y2, w, hBottom ), 0, (_h3-hBottom)*dpr, w2, hBottom*dpr );
+        }
+
+        // left and right
+        if( h > 0 )
+        {
+            if( tiles&Left ) addFragment( 3, QRectF( x0, y1, wLeft, h ), 0, 0, wLeft*dpr, h2 );
+            if( tiles&Right ) addFragment( 5, QRectF( x2, y1, wRight, h ), (_w3-wRight)*dpr, 0, wRight*dpr, h2 );
+        }
+
+        // center
+        if( (tiles&Center) && h > 0 && w > 0 ) addFragment( 4, QRectF( x1, y1, w, h ), 0, 0, _sourceRects[4].width(), _sourceRects[4].height() );
+
+        // render all fragments at once
+        if( count > 0 ) painter->drawPixmapFragments( fragments, count, _atlas );
+
+    }
+
 }
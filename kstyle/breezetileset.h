@@ -21,6 +21,17 @@ namespace Breeze
     class TileSet
     {
         public:
+
+        //* chunk storage
+        enum StorageMode
+        {
+            //* one pixmap per chunk
+            Pixmaps,
+
+            //* single pixmap, with one source rect per chunk, rendered in one batched call
+            Atlas
+        };
+
         /**
         Create a TileSet from a pixmap. The size of the bottom/right chunks is
         whatever is left over from the other chunks, whose size is specified
@@ -30,8 +41,9 @@ namespace Breeze
         @param h1 height of the top chunks
         @param w2 width of the not-left-or-right chunks
         @param h2 height of the not-top-or-bottom chunks
+        @param mode how chunks are stored
         */
-        TileSet(const QPixmap&, int w1, int h1, int w2, int h2 );
+        TileSet(const QPixmap&, int w1, int h1, int w2, int h2, StorageMode mode = Pixmaps );
 
         //* empty constructor
         TileSet();
@@ -77,11 +89,10 @@ namespace Breeze
 
         //* is valid
         bool isValid() const
-        { return _pixmaps.size() == 9; }
+        { return _mode == Atlas ? ( !_atlas.isNull() && _sourceRects.size() == 9 ) : _pixmaps.size() == 9; }
 
         //* returns pixmap for given index
-        QPixmap pixmap( int index ) const
-        { return _pixmaps[index]; }
+        QPixmap pixmap( int index ) const;
 
         protected:
 
@@ -91,11 +102,26 @@ namespace Breeze
         //* initialize pixmap
         void initPixmap( PixmapList&, const QPixmap&, int w, int h, const QRect& );
 
+        //* render from atlas, using a single drawPixmapFragments call
+        void renderAtlas( QPainter*, Tiles, const QRect& target, int wLeft, int wRight, int hTop, int hBottom ) const;
+
         private:
 
+        //* storage mode
+        StorageMode _mode = Pixmaps;
+
         //* pixmap arry
         PixmapList _pixmaps;
 
+        //* atlas pixmap
+        QPixmap _atlas;
+
+        //* source rect of each chunk in atlas, in device pixels
+        QVector<QRectF> _sourceRects;
+
+        //* device pixel ratio
+        qreal _devicePixelRatio = 1;
+
         // dimensions
         int _w1;
         int _h1;
@@ -29,16 +29,6 @@ namespace Breeze {
 
     ToolsAreaManager::~ToolsAreaManager() {}
 
-    template<class T1, class T2>
-    void appendIfNotAlreadyExists(T1* list, T2 item) {
-        for (auto listItem : *list) {
-            if (listItem == item) {
-                return;
-            }
-        }
-        list->append(item);
-    }
-
     void ToolsAreaManager::registerApplication(QApplication *application)
     {
         _listener = new AppListener;
@@ -57,50 +47,92 @@ namespace Breeze {
     {
         Q_ASSERT(window);
 
+        auto iter = _windows.constFind(window);
+        if (iter == _windows.constEnd() || iter->height < 0) {
+            updateToolsArea(const_cast<QMainWindow*>(window));
+            iter = _windows.constFind(window);
+        }
+
+        return QRect(0, 0, window->width(), iter->height);
+    }
+
+    void ToolsAreaManager::updateToolsArea(QMainWindow *window)
+    {
+        Q_ASSERT(window);
+
+        auto& toolsArea = _windows[window];
         int itemHeight = window->menuWidget() ? window->menuWidget()->height() : 0;
-        for (auto item : _windows[const_cast<QMainWindow*>(window)]) {
-            if (!item.isNull() && item->isVisible() && window->toolBarArea(item) == Qt::TopToolBarArea) {
+        for (auto item : qAsConst(toolsArea.toolBars)) {
+            if (item->isVisible()) {
                 itemHeight = qMax(item->mapTo(window, item->rect().bottomLeft()).y(), itemHeight);
             }
         }
 
+        // only touch contents margins when they change, since it triggers a relayout
+        QMargins margins;
         if (itemHeight == 0 && !(window->property(PropertyNames::noSeparator).toBool())) {
-            auto win = const_cast<QMainWindow*>(window);
-            win->setContentsMargins(0, 1, 0, 0);
-        } else {
-            auto win = const_cast<QMainWindow*>(window);
-            win->setContentsMargins(0, 0, 0, 0);
+            margins = QMargins(0, 1, 0, 0);
+        }
+        if (window->contentsMargins() != margins) {
+            window->setContentsMargins(margins);
         }
 
-        return QRect(0, 0, window->width(), itemHeight);
+        const int oldHeight = toolsArea.height;
+        if (oldHeight != itemHeight) {
+            toolsArea.height = itemHeight;
+            if (oldHeight >= 0) {
+                window->update(0, 0, window->width(), qMax(oldHeight, itemHeight) + 1);
+            }
+        }
     }
 
-    bool ToolsAreaManager::tryRegisterToolBar(QPointer<QMainWindow> window, QPointer<QWidget> widget)
+    void ToolsAreaManager::updateToolBar(QMainWindow *window, QToolBar *toolbar)
     {
-        Q_ASSERT(!widget.isNull());
+        Q_ASSERT(window);
+        Q_ASSERT(toolbar);
 
-        QPointer<QToolBar> toolbar;
-        if (!(toolbar = qobject_cast<QToolBar*>(widget))) return false;
+        auto iter = _watched.find(toolbar);
+        if (iter == _watched.end()) return;
 
-        if (window->toolBarArea(toolbar) == Qt::TopToolBarArea) {
-            widget->setPalette(palette());
-            appendIfNotAlreadyExists(&_windows[window], toolbar);
-            return true;
-        }
+        const bool inToolsArea = window->toolBarArea(toolbar) == Qt::TopToolBarArea;
+        if (inToolsArea == iter->inToolsArea) return;
 
-        return false;
+        iter->inToolsArea = inToolsArea;
+        if (inToolsArea) {
+            _windows[window].toolBars.append(toolbar);
+            toolbar->setPalette(palette());
+        } else {
+            _windows[window].toolBars.removeOne(toolbar);
+            toolbar->setPalette(window->palette());
+        }
     }
 
-    void ToolsAreaManager::tryUnregisterToolBar(QPointer<QMainWindow> window, QPointer<QWidget> widget)
+    void ToolsAreaManager::watch(QMainWindow *window, QWidget *widget)
     {
-        Q_ASSERT(!widget.isNull());
+        Q_ASSERT(window);
+        Q_ASSERT(widget);
+
+        auto iter = _watched.find(widget);
+        if (iter != _watched.end() && iter->window == window) return;
 
-        QPointer<QToolBar> toolbar;
-        if (!(toolbar = qobject_cast<QToolBar*>(widget))) return;
+        // owning window changed
+        if (iter != _watched.end()) unwatch(widget);
 
-        if (window->toolBarArea(toolbar) != Qt::TopToolBarArea) {
-            widget->setPalette(window->palette());
-            _windows[window].removeAll(toolbar);
+        Watched watched;
+        watched.window = window;
+        _watched.insert(widget, watched);
+
+        widget->removeEventFilter(this);
+        widget->installEventFilter(this);
+    }
+
+    void ToolsAreaManager::unwatch(QObject *object)
+    {
+        const auto watched = _watched.take(object);
+        object->removeEventFilter(this);
+
+        if (watched.inToolsArea) {
+            _windows[watched.window].toolBars.removeOne(static_cast<QToolBar*>(object));
         }
     }
 
@@ -119,11 +151,9 @@ namespace Breeze {
         _palette.setBrush(QPalette::Inactive, QPalette::Window, inactive.background());
         _palette.setBrush(QPalette::Inactive, QPalette::WindowText, inactive.foreground());
 
-        for (auto window : _windows) {
-            for (auto toolbar : window) {
-                if (!toolbar.isNull()) {
-                    toolbar->setPalette(_palette);
-                }
+        for (const auto& toolsArea : qAsConst(_windows)) {
+            for (auto toolbar : toolsArea.toolBars) {
+                toolbar->setPalette(_palette);
             }
         }
 
@@ -165,35 +195,59 @@ namespace Breeze {
         Q_ASSERT(watched);
         Q_ASSERT(event);
 
-        QPointer<QObject> parent = watched;
-        QPointer<QMainWindow> mainWindow = nullptr;
-        while (parent != nullptr) {
-            if (qobject_cast<QMainWindow*>(parent)) {
-                mainWindow = qobject_cast<QMainWindow*>(parent);
+        switch (event->type()) {
+            case QEvent::ChildAdded:
+            case QEvent::ChildRemoved:
+            case QEvent::DynamicPropertyChange:
+            case QEvent::Move:
+            case QEvent::Resize:
+            case QEvent::Show:
+            case QEvent::Hide:
                 break;
-            }
-            parent = parent->parent();
+            default:
+                return false;
         }
 
-        if (QPointer<QMainWindow> mw = qobject_cast<QMainWindow*>(watched)) {
-            QChildEvent *ev = nullptr;
-            if (event->type() == QEvent::ChildAdded || event->type() == QEvent::ChildRemoved)
-                ev = static_cast<QChildEvent*>(event);
+        // owning main window is stored at registration
+        const auto iter = _watched.constFind(watched);
+        if (iter == _watched.constEnd()) {
+            return false;
+        }
+        QMainWindow *mainWindow = iter->window;
 
-            QPointer<QToolBar> tb = qobject_cast<QToolBar*>(ev->child());
-            if (tb.isNull())
-                return false;
+        if (watched == mainWindow) {
+            if (event->type() == QEvent::ChildAdded || event->type() == QEvent::ChildRemoved) {
+                auto ev = static_cast<QChildEvent*>(event);
+                if (!ev->child()->isWidgetType()) {
+                    return false;
+                }
+
+                if (ev->added()) {
+                    // toolbar area is only known once the toolbar is laid out. It is checked on geometry changes
+                    if (auto tb = qobject_cast<QToolBar*>(ev->child())) {
+                        watch(mainWindow, tb);
+                    }
+                } else if (ev->removed() && _watched.contains(ev->child())) {
+                    // child might be partially destroyed already. Only use its address
+                    unwatch(ev->child());
+                    updateToolsArea(mainWindow);
+                }
 
-            if (ev->added()) {
-                if (mw->toolBarArea(tb) == Qt::TopToolBarArea)
-                    appendIfNotAlreadyExists(&_windows[mw], tb);
-            } else if (ev->removed()) {
-                _windows[mw].removeAll(tb);
+            } else if (event->type() == QEvent::DynamicPropertyChange) {
+                auto ev = static_cast<QDynamicPropertyChangeEvent*>(event);
+                if (ev->propertyName() == PropertyNames::noSeparator) {
+                    updateToolsArea(mainWindow);
+                }
             }
-        } else if (qobject_cast<QToolBar*>(watched)) {
-            if (!mainWindow.isNull()) {
-                tryUnregisterToolBar(mainWindow, qobject_cast<QWidget*>(watched));
+
+        } else if (event->type() != QEvent::ChildAdded && event->type() != QEvent::ChildRemoved && event->type() != QEvent::DynamicPropertyChange) {
+
+            // toolbar or menubar geometry changed
+            if (auto toolbar = qobject_cast<QToolBar*>(watched)) {
+                updateToolBar(mainWindow, toolbar);
             }
+
+            updateToolsArea(mainWindow);
         }
 
         return false;
@@ -220,30 +274,51 @@ namespace Breeze {
         if (mainWindow != mainWindow->window()) {
             return;
         }
-        tryRegisterToolBar(mainWindow, widget);
+
+        // watch main window, its toolbars and its menubar, to keep the tools area up to date
+        if (widget == mainWindow) {
+            watch(mainWindow, widget);
+            connect(mainWindow.data(), &QObject::destroyed, this, &ToolsAreaManager::windowDestroyed, Qt::UniqueConnection);
+        } else if (auto toolbar = qobject_cast<QToolBar*>(widget)) {
+            // only toolbars managed by the main window layout can be part of the tools area
+            if (toolbar->parentWidget() != mainWindow) {
+                return;
+            }
+            watch(mainWindow, toolbar);
+            updateToolBar(mainWindow, toolbar);
+        } else if (widget == mainWindow->menuWidget()) {
+            watch(mainWindow, widget);
+        }
     }
 
     void ToolsAreaManager::unregisterWidget(QWidget *widget)
     {
         Q_ASSERT(widget);
-        auto ptr = QPointer<QWidget>(widget);
 
-        if (QPointer<QMainWindow> window = qobject_cast<QMainWindow*>(ptr)) {
-            _windows.remove(window);
+        const auto iter = _watched.constFind(widget);
+        if (iter == _watched.constEnd()) {
             return;
-        } else if (QPointer<QToolBar> toolbar = qobject_cast<QToolBar*>(ptr)) {
-            auto parent = ptr;
-            QPointer<QMainWindow> mainWindow = nullptr;
-            while (parent != nullptr) {
-                if (qobject_cast<QMainWindow*>(parent)) {
-                    mainWindow = qobject_cast<QMainWindow*>(parent);
-                    break;
-                }
-                parent = parent->parentWidget();
-            } if (mainWindow == nullptr) {
-                return;
+        }
+
+        QMainWindow *mainWindow = iter->window;
+        unwatch(widget);
+
+        if (widget == mainWindow) {
+            _windows.remove(mainWindow);
+        } else {
+            updateToolsArea(mainWindow);
+        }
+    }
+
+    void ToolsAreaManager::windowDestroyed(QObject *object)
+    {
+        _windows.remove(static_cast<QMainWindow*>(object));
+        for (auto iter = _watched.begin(); iter != _watched.end();) {
+            if (iter->window == object) {
+                iter = _watched.erase(iter);
+            } else {
+                ++iter;
             }
-            _windows[mainWindow].removeAll(toolbar);
         }
     }
 
@@ -30,8 +30,27 @@ namespace Breeze {
         Q_OBJECT
 
     private:
+        // per main window tools area
+        struct ToolsArea
+        {
+            // toolbars in the top toolbar area
+            QVector<QToolBar*> toolBars;
+            // height, updated from toolbar and menubar geometry changes
+            int height = -1;
+        };
+
+        // owning main window of a watched object
+        struct Watched
+        {
+            QMainWindow* window = nullptr;
+            // true for toolbars stored in the window tools area
+            bool inToolsArea = false;
+        };
+
         Helper* _helper;
-        QHash<QMainWindow*,QVector<QPointer<QToolBar>>> _windows;
+        QHash<const QMainWindow*,ToolsArea> _windows;
+        // main window, toolbars and menubar with this installed as event filter
+        QHash<const QObject*,Watched> _watched;
         KSharedConfigPtr _config;
         KConfigWatcher::Ptr _watcher;
         QPalette _palette = QPalette();
@@ -41,10 +60,20 @@ namespace Breeze {
         friend class AppListener;
 
     protected:
-        bool tryRegisterToolBar(QPointer<QMainWindow> window, QPointer<QWidget> widget);
-        void tryUnregisterToolBar(QPointer<QMainWindow> window, QPointer<QWidget> widget);
+        // add or remove toolbar from the tools area, depending on its toolbar area
+        void updateToolBar(QMainWindow *window, QToolBar *toolbar);
         void configUpdated();
 
+        // install event filter on widget and store owning window
+        void watch(QMainWindow *window, QWidget *widget);
+        void unwatch(QObject *object);
+
+        // recompute the tools area of the given window, and its contents margins if needed
+        void updateToolsArea(QMainWindow *window);
+
+    protected Q_SLOTS:
+        void windowDestroyed(QObject *object);
+
     public:
         explicit ToolsAreaManager(Helper *helper, QObject *parent = nullptr);
         ~ToolsAreaManager();
@@ -57,6 +86,7 @@ namespace Breeze {
         void registerWidget(QWidget *widget);
         void unregisterWidget(QWidget *widget);
 
+        // cached tools area rect. Computed on first call if not yet known
         QRect toolsAreaRect(const QMainWindow *window);
 
         bool hasHeaderColors();
@@ -141,6 +141,9 @@ namespace Breeze
         _appEventFilter = new AppEventFilter( this );
         qApp->installEventFilter( _appEventFilter );
 
+        // application specific exceptions depend on application name
+        connect( qApp, &QCoreApplication::applicationNameChanged, this, &WindowManager::invalidateLists );
+
     }
 
     //_____________________________________________________________
@@ -214,6 +217,9 @@ namespace Breeze
             if( !id.className().isEmpty() )
             { _whiteList.insert( ExceptionId( exception ) ); }
         }
+
+        invalidateLists();
+
     }
 
     //_____________________________________________________________
@@ -233,6 +239,72 @@ namespace Breeze
             { _blackList.insert( ExceptionId( exception ) ); }
         }
 
+        invalidateLists();
+
+    }
+
+    //_____________________________________________________________
+    void WindowManager::invalidateLists()
+    {
+
+        // grabbing may have been disabled for the previous application name
+        if( _blackListAll )
+        {
+            _blackListAll = false;
+            setEnabled( StyleConfigData::windowDragMode() != StyleConfigData::WD_NONE );
+        }
+
+        _listsValid = false;
+        _whiteListCache.clear();
+        _blackListCache.clear();
+
+    }
+
+    //_____________________________________________________________
+    void WindowManager::compileLists()
+    {
+
+        if( _listsValid ) return;
+
+        /*
+        lists are compiled on first use rather than in initialize,
+        because the style is created before most applications set their name
+        */
+        const auto appName( qApp->applicationName() );
+        _whiteListClassNames = compile( _whiteList, appName );
+        _blackListClassNames = compile( _blackList, appName );
+
+        // if application name matches and all classes are selected
+        _blackListAll = false;
+        foreach( const ExceptionId& id, _blackList )
+        {
+            if( id.className() == QLatin1String( "*" ) && !id.appName().isEmpty() && id.appName() == appName )
+            {
+                _blackListAll = true;
+                break;
+            }
+        }
+
+        _listsValid = true;
+
+    }
+
+    //_____________________________________________________________
+    WindowManager::ClassNameList WindowManager::compile( const ExceptionSet& exceptions, const QString& appName )
+    {
+
+        ClassNameList out;
+        foreach( const ExceptionId& id, exceptions )
+        {
+            if( !( id.appName().isEmpty() || id.appName() == appName ) ) continue;
+            if( id.className() == QLatin1String( "*" ) ) continue;
+
+            const auto className( id.className().toLatin1() );
+            if( !out.contains( className ) ) out.append( className );
+        }
+
+        return out;
+
     }
 
     //_____________________________________________________________
@@ -476,36 +548,52 @@ namespace Breeze
         const auto propertyValue( widget->property( PropertyNames::noWindowGrab ) );
         if( propertyValue.isValid() && propertyValue.toBool() ) return true;
 
-        // list-based blacklisted widgets
-        const auto appName( qApp->applicationName() );
-        foreach( const ExceptionId& id, _blackList )
+        compileLists();
+        if( _blackListAll )
         {
-            if( !id.appName().isEmpty() && id.appName() != appName ) continue;
-            if( id.className() == QStringLiteral( "*" ) && !id.appName().isEmpty() )
-            {
-                // if application name matches and all classes are selected
-                // disable the grabbing entirely
-                setEnabled( false );
-                return true;
-            }
-            if( widget->inherits( id.className().toLatin1().data() ) ) return true;
+            // if application name matches and all classes are selected
+            // disable the grabbing entirely
+            setEnabled( false );
+            return true;
         }
 
-        return false;
+        // list-based blacklisted widgets
+        return matches( widget, _blackListClassNames, _blackListCache );
+
     }
 
     //_____________________________________________________________
-    bool WindowManager::isWhiteListed( QWidget* widget ) const
+    bool WindowManager::isWhiteListed( QWidget* widget )
     {
+        compileLists();
+        return matches( widget, _whiteListClassNames, _whiteListCache );
+    }
 
-        const auto appName( qApp->applicationName() );
-        foreach( const ExceptionId& id, _whiteList )
+    //_____________________________________________________________
+    bool WindowManager::matches( const QWidget* widget, const ClassNameList& classNames, MetaObjectCache& cache )
+    {
+
+        if( classNames.isEmpty() ) return false;
+
+        // check cache
+        const auto metaObject( widget->metaObject() );
+        const auto iter( cache.constFind( metaObject ) );
+        if( iter != cache.constEnd() ) return iter.value();
+
+        // check class names and store verdict
+        bool value( false );
+        foreach( const QByteArray& className, classNames )
         {
-            if( !(id.appName().isEmpty() || id.appName() == appName ) ) continue;
-            if( widget->inherits( id.className().toLatin1().data() ) ) return true;
+            if( widget->inherits( className.constData() ) )
+            {
+                value = true;
+                break;
+            }
         }
 
-        return false;
+        cache.insert( metaObject, value );
+        return value;
+
     }
 
     //_____________________________________________________________
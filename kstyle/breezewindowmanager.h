@@ -15,9 +15,12 @@
 
 #include <QApplication>
 #include <QBasicTimer>
+#include <QByteArray>
+#include <QHash>
 #include <QObject>
 #include <QSet>
 #include <QString>
+#include <QVector>
 #include <QWidget>
 
 #if BREEZE_HAVE_QTQUICK
@@ -55,6 +58,11 @@ namespace Breeze
         //* event filter [reimplemented]
         bool eventFilter( QObject*, QEvent* ) override;
 
+        protected Q_SLOTS:
+
+        //* invalidate lists compiled for the current application
+        void invalidateLists();
+
         protected:
 
         //* timer event,
@@ -120,7 +128,17 @@ namespace Breeze
         bool isBlackListed( QWidget* );
 
         //* returns true if widget is dragable
-        bool isWhiteListed( QWidget* ) const;
+        bool isWhiteListed( QWidget* );
+
+        //* compiled list of class names
+        using ClassNameList = QVector<QByteArray>;
+
+        //* verdict cache, per meta object
+        using MetaObjectCache = QHash<const QMetaObject*, bool>;
+
+        //* returns true if widget inherits any of the class names in list
+        /** the result is cached per meta object */
+        static bool matches( const QWidget*, const ClassNameList&, MetaObjectCache& );
 
         //* returns true if drag can be started from current widget
         bool canDrag( QWidget* );
@@ -204,6 +222,12 @@ namespace Breeze
         //* exception set
         using ExceptionSet = QSet<ExceptionId>;
 
+        //* compile exception set into list of latin1 class names matching given application
+        static ClassNameList compile( const ExceptionSet&, const QString& );
+
+        //* compile white and black lists for current application, if needed
+        void compileLists();
+
         //* list of white listed special widgets
         /**
         it is read from options and is used to adjust
@@ -218,6 +242,29 @@ namespace Breeze
         */
         ExceptionSet _blackList;
 
+        //*@name lists compiled for the current application
+        //@{
+
+        //* true if compiled lists match current application name
+        bool _listsValid = false;
+
+        //* white listed class names
+        ClassNameList _whiteListClassNames;
+
+        //* black listed class names
+        ClassNameList _blackListClassNames;
+
+        //* true if all classes are black listed for the current application
+        bool _blackListAll = false;
+
+        //@}
+
+        //* white list verdict, per meta object
+        MetaObjectCache _whiteListCache;
+
+        //* black list verdict, per meta object
+        MetaObjectCache _blackListCache;
+
         //* drag point
         QPoint _dragPoint;
         QPoint _globalDragPoint;